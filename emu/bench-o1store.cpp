@@ -0,0 +1,173 @@
+//
+// micro benchmark of the churn of 'o1store' where instances are freed and
+// allocated every frame as when bullets die while fragments spawn
+// reports best of 5 runs in nanoseconds per frame of 'alloc()', 'free()' and
+// 'apply_free()' and a checksum of the order of the allocated list for the
+// store with pointers and with 16-bit indexes
+// see `make-bench-o1store.sh`
+//
+
+#include "../src/o1store.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+// instance of the size of a game object with pointer back reference
+class item final {
+  public:
+    item** alloc_ptr;
+    // note: no default value since it would overwrite the 'o1store' assigned
+    //       value at 'alloc()'
+    int32_t frame{};
+    uint8_t data[52]{};
+
+    // note: user provided constructor so that 'item{}' does not zero
+    //       'alloc_ptr'
+    item() {}
+};
+
+// same as 'item' with index back reference
+class item_ix final {
+  public:
+    uint16_t alloc_ix;
+    int32_t frame{};
+    uint8_t data[52]{};
+
+    item_ix() {}
+};
+
+static int32_t constexpr store_size = 1024;
+
+using item_store = o1store<item, store_size, 0>;
+using item_ix_store =
+    o1store<item_ix, store_size, 0, 0, o1store_calloc, uint16_t>;
+
+// deterministic random numbers
+static uint32_t rnd_state = 1;
+
+static auto rnd(uint32_t const n) -> uint32_t {
+    rnd_state ^= rnd_state << 13;
+    rnd_state ^= rnd_state >> 17;
+    rnd_state ^= rnd_state << 5;
+    return rnd_state % n;
+}
+
+// returns instance of element in allocated list
+static auto instance(item_store const& /*store*/, item* it) -> item* {
+    return it;
+}
+
+static auto instance(item_ix_store const& store, uint16_t const ix)
+    -> item_ix* {
+    return store.instance(ix);
+}
+
+// runs 'frames' frames of freeing random instances and allocating new ones
+// where the larger of 'n_a' and 'n_b' is freed when more than 'live'
+// instances are allocated and the smaller otherwise
+// returns nanoseconds per frame and writes checksum of the allocated list
+template <typename store_type, typename item_type>
+static auto churn(int32_t const frames, int32_t const live, int32_t const n_a,
+                  int32_t const n_b, uint32_t& checksum) -> double {
+    int32_t const n_max = n_a > n_b ? n_a : n_b;
+    int32_t const n_min = n_a > n_b ? n_b : n_a;
+    store_type& store = *new store_type;
+    rnd_state = 1;
+    for (int32_t i = 0; i < live; ++i) {
+        new (store.alloc()) item_type{};
+    }
+    store.apply_free();
+
+    using clock = std::chrono::steady_clock;
+    clock::time_point const t0 = clock::now();
+    for (int32_t f = 0; f < frames; ++f) {
+        int32_t const len = store.allocated_list_len();
+        int32_t const n_free = len > live ? n_max : n_min;
+        int32_t const n_alloc = len > live ? n_min : n_max;
+        // free random instances once
+        auto list = store.allocated_list();
+        for (int32_t i = 0; i < n_free; ++i) {
+            item_type* it = instance(store, list[rnd(uint32_t(len))]);
+            if (it->frame == -1) {
+                continue;
+            }
+            it->frame = -1;
+            store.free(it);
+        }
+        for (int32_t i = 0; i < n_alloc; ++i) {
+            item_type* it = store.alloc();
+            if (!it) {
+                break;
+            }
+            new (it) item_type{};
+            it->frame = f;
+        }
+        store.apply_free();
+    }
+    clock::time_point const t1 = clock::now();
+
+    // checksum of the order of the allocated list
+    checksum = 0;
+    auto const end = store.allocated_list_end();
+    for (auto it = store.allocated_list(); it < end; ++it) {
+        checksum =
+            checksum * 31 + uint32_t(store.instance_ix(instance(store, *it)));
+    }
+    delete &store;
+
+    return double(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      t1 - t0)
+                      .count()) /
+           frames;
+}
+
+auto main(int argc, char** argv) -> int {
+    int32_t frames = 200000;
+    if (argc > 2 && !strcmp(argv[1], "-f")) {
+        frames = atoi(argv[2]);
+    }
+
+    struct workload {
+        char const* name;
+        int32_t live;
+        int32_t n_a;
+        int32_t n_b;
+    };
+    workload const workloads[]{
+        {"balanced", 200, 16, 16},
+        {"unbalanced", 200, 24, 8},
+        {"heavy", 800, 128, 128},
+        {"heavy unbal", 800, 192, 64},
+    };
+
+    item_store const& ptr_store = *new item_store;
+    item_ix_store const& ix_store = *new item_ix_store;
+    printf("data size: pointers %d B, indexes %d B\n",
+           ptr_store.allocated_data_size_B(), ix_store.allocated_data_size_B());
+
+    printf("%12s  %5s  %9s  %10s  %10s  %8s\n", "workload", "live",
+           "free/alloc", "ns ptr", "ns ix", "order");
+    for (workload const& w : workloads) {
+        // note: best of runs to reduce noise of the host
+        uint32_t checksum = 0;
+        uint32_t checksum_ix = 0;
+        double ns = 0;
+        double ns_ix = 0;
+        for (int32_t i = 0; i < 5; ++i) {
+            double const t = churn<item_store, item>(frames, w.live, w.n_a,
+                                                     w.n_b, checksum);
+            ns = i == 0 || t < ns ? t : ns;
+            double const t_ix = churn<item_ix_store, item_ix>(
+                frames, w.live, w.n_a, w.n_b, checksum_ix);
+            ns_ix = i == 0 || t_ix < ns_ix ? t_ix : ns_ix;
+        }
+        printf("%12s  %5d  %4d/%-5d  %10.1f  %10.1f  %08x%s\n", w.name,
+               w.live, w.n_a, w.n_b, ns, ns_ix, checksum,
+               checksum == checksum_ix ? "" : " !!! order differs");
+    }
+    return 0;
+}
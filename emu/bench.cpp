@@ -0,0 +1,414 @@
+//
+// headless benchmark runner of the emulator
+// runs frames of the application at maximum speed with a virtual clock and
+// reports frame time percentiles and time per stage of 'engine_loop()'
+// optionally plays an input script and records or verifies golden frames
+// optionally writes a Chrome trace of the frames when built with `BAM_TRACE`
+// see `make-bench.sh` for supplied defines
+//
+
+// note: the virtual clock advances 'BAM_TIME_STEP_MS' every frame so the
+//       simulation is the same on every run independent of host speed
+
+// first the application defs
+#include "../src/application/defs.hpp"
+// then the device
+#include "device_headless.hpp"
+// then the common renderer
+#include "../src/renderer.hpp"
+// then the main entry file to user code
+#include "../src/application/application.hpp"
+// then the estimate of frame time on the boards
+#include "estimate.hpp"
+// then input scripts and golden frames
+#include "golden.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+// instantiate the device implementation
+static device_headless device;
+
+// virtual time in milliseconds since start
+static unsigned long bench_ms;
+
+// arduino replacement
+auto millis() -> unsigned long { return bench_ms; }
+
+// functions used in `renderer.hpp` to decouple from device implementation
+#include "device_functions.hpp"
+
+static_assert(engine_stage_timing, "build with `-D BAM_STAGE_TIMING`");
+
+using bench_clock = std::chrono::steady_clock;
+
+auto device_micros() -> uint32_t {
+    return uint32_t(std::chrono::duration_cast<std::chrono::microseconds>(
+                        bench_clock::now().time_since_epoch())
+                        .count());
+}
+
+// per frame timings in nanoseconds
+static std::vector<uint64_t> bench_frame_ns;
+static std::vector<uint64_t> bench_stage_ns[engine_stage_count];
+
+// time at end of previous stage in current frame
+static bench_clock::time_point bench_stage_t0;
+
+// totals of renderer counters
+static int64_t bench_dma_writes;
+static int64_t bench_dma_skips;
+
+// true if checksums of frames are computed
+static bool bench_golden;
+
+// checksums of frames when 'bench_golden'
+static std::vector<golden_frame> bench_golden_frames;
+
+// checksum of the 'col_with' of objects in current frame
+static uint32_t bench_collisions_crc;
+
+// returns checksum of the collisions of objects detected by render
+// note: objects are identified by position in the list of allocated objects
+//       which does not depend on the memory layout of the object store
+static auto bench_collisions_crc32() -> uint32_t {
+    uint32_t crc = 0;
+    object* const* const bgn = objects.allocated_list();
+    object const* const* end = objects.allocated_list_end();
+    for (object* const* it = bgn; it < end; ++it) {
+        object const* obj = *it;
+        if (!obj->col_with) {
+            continue;
+        }
+        int32_t const col[]{int32_t(it - bgn),
+                            int32_t(obj->col_with->alloc_ptr - bgn)};
+        crc = golden_crc32(crc, col, sizeof(col));
+    }
+    return crc;
+}
+
+auto device_engine_stage_done(engine_stage const stage) -> void {
+    bench_clock::time_point const t = bench_clock::now();
+    bench_stage_ns[stage].push_back(uint64_t(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(t - bench_stage_t0)
+            .count()));
+    if (bench_golden && stage == engine_stage_render) {
+        // note: 'col_with' is set on objects at end of render in all modes
+        bench_collisions_crc = bench_collisions_crc32();
+        // note: time of checksum is not included in the next stage
+        bench_stage_t0 = bench_clock::now();
+        return;
+    }
+    bench_stage_t0 = t;
+}
+
+// summary of timings in microseconds
+struct bench_summary {
+    double avg;
+    double p50;
+    double p95;
+    double p99;
+    double max;
+};
+
+// returns summary of 'ns' using nearest-rank percentiles
+static auto bench_summarize(std::vector<uint64_t> ns) -> bench_summary {
+    bench_summary sum{};
+    if (ns.empty()) {
+        return sum;
+    }
+    std::sort(ns.begin(), ns.end());
+    uint64_t total = 0;
+    for (uint64_t const t : ns) {
+        total += t;
+    }
+    size_t const n = ns.size();
+    auto const rank = [&](size_t const p) -> double {
+        size_t const i = (p * n + 99) / 100;
+        return double(ns[i ? i - 1 : 0]) / 1000.0;
+    };
+    sum.avg = double(total) / double(n) / 1000.0;
+    sum.p50 = rank(50);
+    sum.p95 = rank(95);
+    sum.p99 = rank(99);
+    sum.max = double(ns[n - 1]) / 1000.0;
+    return sum;
+}
+
+static auto bench_print(char const* name, bench_summary const& sum) -> void {
+    printf("%12s  %9.1f  %9.1f  %9.1f  %9.1f  %9.1f\n", name, sum.avg, sum.p50,
+           sum.p95, sum.p99, sum.max);
+}
+
+static auto bench_write_summary(FILE* f, bench_summary const& sum) -> void {
+    fprintf(f,
+            "{\"avg\": %.1f, \"p50\": %.1f, \"p95\": %.1f, \"p99\": %.1f, "
+            "\"max\": %.1f}",
+            sum.avg, sum.p50, sum.p95, sum.p99, sum.max);
+}
+
+// writes results as json to 'path'
+// returns false if file could not be written
+static auto bench_write_results(char const* path, int32_t const frames)
+    -> bool {
+    FILE* f = fopen(path, "w");
+    if (!f) {
+        return false;
+    }
+    fprintf(f, "{\n");
+    fprintf(f, "  \"frames\": %d,\n", frames);
+    fprintf(f, "  \"time_step_ms\": %d,\n", BAM_TIME_STEP_MS);
+    fprintf(f, "  \"display\": [%d, %d],\n", display_width, display_height);
+    fprintf(f, "  \"config\": {\n");
+    fprintf(f, "    \"skip_unchanged_bands\": %s,\n",
+            render_skip_unchanged_bands ? "true" : "false");
+    fprintf(f, "    \"parallel_render\": %s,\n",
+            render_parallel ? "true" : "false");
+    fprintf(f, "    \"pipelined_update\": %s,\n",
+            engine_pipelined ? "true" : "false");
+    fprintf(f, "    \"cooperative_update\": %s,\n",
+            engine_cooperative ? "true" : "false");
+    fprintf(f, "    \"tile_row_cache\": %s,\n",
+            render_tile_row_cache ? "true" : "false");
+    fprintf(f, "    \"sprite_opaque_runs\": %s,\n",
+            render_sprite_opaque_runs ? "true" : "false");
+    fprintf(f, "    \"dma_bus\": \"%s\"\n", dma_bus_emulated.name);
+    fprintf(f, "  },\n");
+    fprintf(f, "  \"frame_us\": ");
+    bench_write_summary(f, bench_summarize(bench_frame_ns));
+    fprintf(f, ",\n");
+    fprintf(f, "  \"stage_us\": {\n");
+    for (int32_t i = 0; i < engine_stage_count; ++i) {
+        fprintf(f, "    \"%s\": ", engine_stage_names[i]);
+        bench_write_summary(f, bench_summarize(bench_stage_ns[i]));
+        fprintf(f, i < engine_stage_count - 1 ? ",\n" : "\n");
+    }
+    fprintf(f, "  },\n");
+    fprintf(f, "  \"dma_writes\": %lld,\n",
+            static_cast<long long>(bench_dma_writes));
+    fprintf(f, "  \"dma_skips\": %lld,\n",
+            static_cast<long long>(bench_dma_skips));
+    if (counters_enabled) {
+        fprintf(f, "  \"ops_per_frame\": {\n");
+        for (int32_t i = 0; i < counter_count; ++i) {
+            fprintf(f, "    \"%s\": %u%s\n", counter_names[i],
+                    counters_avg(counter(i)),
+                    i < counter_count - 1 ? "," : "");
+        }
+        fprintf(f, "  },\n");
+        fprintf(f, "  \"estimated_fps\": {\n");
+        size_t const n = sizeof(estimate_boards) / sizeof(estimate_boards[0]);
+        for (size_t i = 0; i < n; ++i) {
+            fprintf(f, "    \"%s\": %u%s\n", estimate_boards[i].name,
+                    estimate_fps(estimate_boards[i]), i < n - 1 ? "," : "");
+        }
+        fprintf(f, "  },\n");
+    }
+    fprintf(f, "  \"memory_B\": {\n");
+    for (int32_t i = 0; i < memory_region_count; ++i) {
+        fprintf(f, "    \"%s\": %u,\n", memory_region_names[i],
+                memory_region_used_B[i]);
+    }
+    fprintf(f, "    \"arena\": %zu\n", device_arena_used_B);
+    fprintf(f, "  },\n");
+    fprintf(f, "  \"objects\": %d,\n", objects.allocated_list_len());
+    fprintf(f, "  \"sprites\": %d\n", sprites.allocated_list_len());
+    fprintf(f, "}\n");
+    return fclose(f) == 0;
+}
+
+static auto bench_usage() -> int {
+    printf("usage: bench [-f frames] [-o results file] [-i input script]\n"
+           "             [-g golden file to verify] [-w golden file to "
+           "write]\n"
+           "             [-t trace file]\n");
+    return 1;
+}
+
+auto main(int argc, char** argv) -> int {
+    int32_t frames = 1000;
+    char const* results_path = "bench.json";
+    char const* input_path = nullptr;
+    char const* golden_path = nullptr;
+    char const* golden_write_path = nullptr;
+    char const* trace_path = nullptr;
+    for (int i = 1; i < argc; ++i) {
+        if (i + 1 == argc || strlen(argv[i]) != 2 || argv[i][0] != '-') {
+            return bench_usage();
+        }
+        char const* arg = argv[++i];
+        switch (argv[i - 1][1]) {
+        case 'f':
+            frames = atoi(arg);
+            break;
+        case 'o':
+            results_path = arg;
+            break;
+        case 'i':
+            input_path = arg;
+            break;
+        case 'g':
+            golden_path = arg;
+            break;
+        case 'w':
+            golden_write_path = arg;
+            break;
+        case 't':
+            trace_path = arg;
+            break;
+        default:
+            return bench_usage();
+        }
+    }
+    if (frames <= 0) {
+        return bench_usage();
+    }
+    if (trace_path && !trace_enabled) {
+        printf("!!! build with `-D BAM_TRACE` to write trace\n");
+        return 1;
+    }
+
+    std::vector<golden_touch> input;
+    if (input_path && !golden_load_input(input_path, input)) {
+        printf("!!! could not read input script '%s'\n", input_path);
+        return 1;
+    }
+
+    std::vector<golden_frame> golden;
+    if (golden_path && !golden_load(golden_path, golden)) {
+        printf("!!! could not read golden file '%s'\n", golden_path);
+        return 1;
+    }
+    bench_golden = golden_path || golden_write_path;
+
+    if (bench_golden) {
+        device.dma_crc_enable();
+    }
+    device.init();
+
+    renderer_init();
+
+    if (render_parallel || engine_pipelined) {
+        std::thread{render_worker_thread}.detach();
+    }
+
+    clk.init(clk::time(millis()), 0, clk_locked_dt_ms);
+
+    engine_init();
+
+    application_init();
+
+    bench_frame_ns.reserve(size_t(frames));
+    for (std::vector<uint64_t>& v : bench_stage_ns) {
+        v.reserve(size_t(frames));
+    }
+
+    for (int32_t i = 0; i < frames; ++i) {
+        bench_ms += BAM_TIME_STEP_MS;
+        clk.on_frame(clk::time(millis()));
+
+        device::touch touches[10]{};
+        device.set_touch(touches, golden_touches_at(input, i, touches, 10));
+        if (device.display_is_touched()) {
+            uint8_t const touch_count = device.display_touch_count();
+            device.display_get_touch(touches);
+            application_on_touch(touches, touch_count);
+        }
+
+        bench_clock::time_point const t0 = bench_clock::now();
+        bench_stage_t0 = t0;
+        engine_loop();
+        bench_frame_ns.push_back(
+            uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                         bench_clock::now() - t0)
+                         .count()));
+
+        bench_dma_writes += dma_writes;
+        bench_dma_skips += dma_skips;
+
+        if (bench_golden) {
+            // note: the transferred bands and windows are checked so that a
+            //       wrong window or skipped band is detected even if the
+            //       display ends up correct
+            bench_golden_frames.push_back(
+                golden_frame{device.dma_crc_take(), bench_collisions_crc});
+        }
+    }
+
+    printf("frames: %d  dma writes: %lld  skips: %lld  objs: %d  sprs: %d\n",
+           frames, static_cast<long long>(bench_dma_writes),
+           static_cast<long long>(bench_dma_skips),
+           objects.allocated_list_len(), sprites.allocated_list_len());
+    printf("%12s  %9s  %9s  %9s  %9s  %9s\n", "us", "avg", "p50", "p95", "p99",
+           "max");
+    bench_print("frame", bench_summarize(bench_frame_ns));
+    for (int32_t i = 0; i < engine_stage_count; ++i) {
+        bench_print(engine_stage_names[i], bench_summarize(bench_stage_ns[i]));
+    }
+
+    if (!bench_write_results(results_path, frames)) {
+        printf("!!! could not write '%s'\n", results_path);
+        return 1;
+    }
+    printf("results written to '%s'\n", results_path);
+
+    profiler_dump();
+
+    if (counters_enabled) {
+        for (estimate_board const& board : estimate_boards) {
+            printf("estimated fps on %s: %u\n", board.name,
+                   estimate_fps(board));
+        }
+        counters_dump();
+    }
+
+    if (trace_path) {
+        if (!trace_export(trace_path)) {
+            printf("!!! could not write '%s'\n", trace_path);
+            return 1;
+        }
+        printf("trace written to '%s'\n", trace_path);
+    }
+
+    if (golden_write_path) {
+        if (!golden_write(golden_write_path, bench_golden_frames)) {
+            printf("!!! could not write '%s'\n", golden_write_path);
+            return 1;
+        }
+        printf("golden frames written to '%s'\n", golden_write_path);
+    }
+
+    if (golden_path) {
+        if (golden.size() != bench_golden_frames.size()) {
+            printf("!!! golden file has %zu frames, ran %zu\n", golden.size(),
+                   bench_golden_frames.size());
+            return 1;
+        }
+        int32_t mismatches = 0;
+        for (size_t i = 0; i < golden.size(); ++i) {
+            golden_frame const& g = golden[i];
+            golden_frame const& f = bench_golden_frames[i];
+            if (g.dma == f.dma && g.collisions == f.collisions) {
+                continue;
+            }
+            if (!mismatches) {
+                printf("!!! first difference at frame %zu:%s%s\n", i,
+                       g.dma != f.dma ? " dma" : "",
+                       g.collisions != f.collisions ? " collisions" : "");
+            }
+            ++mismatches;
+        }
+        if (mismatches) {
+            printf("!!! %d of %zu frames differ from '%s'\n", mismatches,
+                   golden.size(), golden_path);
+            return 1;
+        }
+        printf("all %zu frames match '%s'\n", golden.size(), golden_path);
+    }
+
+    return 0;
+}
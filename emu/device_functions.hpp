@@ -0,0 +1,114 @@
+#pragma once
+//
+// functions used in `renderer.hpp` shared by the emulator and the headless
+// benchmark runner
+//
+
+// note: included after the global 'device' is declared with the concrete type
+//       of the emulated device
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+
+inline auto device_dma_write_bytes(uint8_t const* data, uint32_t len) -> void {
+    device.dma_write_bytes(data, len);
+    if (trace_enabled) {
+        // note: transfer is simulated from end of write for the modeled time
+        uint64_t const t = device_trace_ns();
+        trace_record("dma", t, t + dma_bus_emulated.transfer_ns(len),
+                     trace_track_dma, int32_t(len));
+    }
+}
+inline auto device_dma_is_busy() -> bool { return device.dma_is_busy(); };
+
+// memory of all regions of the emulated device is allocated from one arena so
+// that the allocations of the engine are measured
+// note: stores are allocated at static initialization before 'main'
+alignas(16) static uint8_t device_arena[8 << 20];
+static size_t device_arena_used_B;
+
+static auto device_arena_alloc(uint32_t const n) -> void* {
+    size_t const bgn = (device_arena_used_B + 15) & ~size_t(15);
+    if (bgn + n > sizeof(device_arena)) {
+        return nullptr;
+    }
+    device_arena_used_B = bgn + n;
+    // note: arena is zero initialized and never freed
+    return &device_arena[bgn];
+}
+
+auto device_alloc_dma_buffer(uint32_t n) -> void* {
+    return device_arena_alloc(n);
+}
+auto device_alloc_internal_buffer(uint32_t n) -> void* {
+    return device_arena_alloc(n);
+}
+auto device_alloc_external_buffer(uint32_t n) -> void* {
+    return device_arena_alloc(n);
+}
+inline auto device_dma_set_write_address_window(int16_t x, int16_t y,
+                                                uint16_t w, uint16_t h)
+    -> void {
+    device.dma_set_write_address_window(x, y, w, h);
+}
+
+// second core emulated by a thread that renders every other band when
+// 'render_parallel' or the whole frame when 'engine_pipelined'
+// note: synchronization objects are never destroyed because the detached
+//       thread is waiting on them at exit
+static std::mutex& render_worker_mutex = *new std::mutex;
+static std::condition_variable& render_worker_cond =
+    *new std::condition_variable;
+static bool render_worker_started;
+static bool render_worker_done;
+
+static auto render_worker_thread() -> void {
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock{render_worker_mutex};
+            render_worker_cond.wait(lock, [] { return render_worker_started; });
+            render_worker_started = false;
+        }
+        render_worker();
+        {
+            std::lock_guard<std::mutex> lock{render_worker_mutex};
+            render_worker_done = true;
+        }
+        render_worker_cond.notify_all();
+    }
+}
+
+auto device_render_worker_begin() -> void {
+    {
+        std::lock_guard<std::mutex> lock{render_worker_mutex};
+        render_worker_started = true;
+        render_worker_done = false;
+    }
+    render_worker_cond.notify_all();
+}
+
+auto device_render_worker_end() -> void {
+    std::unique_lock<std::mutex> lock{render_worker_mutex};
+    render_worker_cond.wait(lock, [] { return render_worker_done; });
+}
+
+inline auto device_render_worker_spin() -> void {
+    // note: host might have fewer cores than threads
+    std::this_thread::yield();
+}
+
+// note: nanoseconds are used as cycles
+auto device_cycles() -> uint32_t {
+    return uint32_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::steady_clock::now().time_since_epoch())
+                        .count());
+}
+auto device_cycles_per_us() -> uint32_t { return 1000; }
+auto device_trace_ns() -> uint64_t {
+    return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::steady_clock::now().time_since_epoch())
+                        .count());
+}
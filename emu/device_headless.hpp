@@ -0,0 +1,164 @@
+#pragma once
+//
+// headless device implementation without display or input used by the
+// benchmark runner
+//
+
+// note: dimensions of the display are defined in `src/display.hpp` from
+//       `TFT_WIDTH` and `TFT_HEIGHT` of the build
+
+#include "../src/application/defs.hpp"
+#include "../src/device.hpp"
+#include "../src/display.hpp"
+#include "dma_bus.hpp"
+#include "golden.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+class device_headless final : public device {
+  public:
+    // note: cleaning up resources omitted because device is alive during
+    //       whole program life time
+
+    auto init() -> void override {
+        buffer_ = new uint16_t[size_t(display_width * display_height)]();
+        if (!buffer_) {
+            throw std::runtime_error("Failed to allocate display buffer");
+        }
+
+        dma_.init(buffer_, uint32_t(display_width));
+        dma_set_write_address_window(0, 0, uint16_t(display_width),
+                                     uint16_t(display_height));
+    }
+
+    // touches are given by the runner with 'set_touch'
+    auto display_is_touched() -> bool override { return touch_count_ > 0; }
+
+    auto display_touch_count() -> uint8_t override { return touch_count_; }
+
+    auto display_get_touch(touch touches[]) -> void override {
+        std::memcpy(touches, touches_, sizeof(touches_));
+    }
+
+    auto dma_write_bytes(uint8_t const* data, uint32_t len) -> void override {
+        dma_.write_bytes(data, len);
+        if (dma_crc_enabled_) {
+            dma_crc_ = golden_crc32(dma_crc_, data, len);
+        }
+    }
+
+    auto dma_is_busy() -> bool override { return dma_.is_busy(); }
+
+    auto dma_wait_for_completion() -> void override {
+        dma_.wait_for_completion();
+    }
+
+    auto dma_set_write_address_window(int16_t const x, int16_t const y,
+                                      uint16_t const w, uint16_t const h)
+        -> void override {
+        dma_.set_write_address_window(x, y, w, h);
+        if (dma_crc_enabled_) {
+            int16_t const window[]{x, y, int16_t(w), int16_t(h)};
+            dma_crc_ = golden_crc32(dma_crc_, window, sizeof(window));
+        }
+    }
+
+    // enables checksum of the pixels and write address windows sent to the
+    // display
+    auto dma_crc_enable() -> void { dma_crc_enabled_ = true; }
+
+    // returns checksum of the pixels and write address windows sent to the
+    // display since previous call
+    auto dma_crc_take() -> uint32_t {
+        uint32_t const crc = dma_crc_;
+        dma_crc_ = 0;
+        return crc;
+    }
+
+    // sets the touches returned by 'display_get_touch' or none if 'count' is 0
+    auto set_touch(touch const touches[], uint8_t const count) -> void {
+        touch_count_ = count < max_touches ? count : max_touches;
+        std::memcpy(touches_, touches, touch_count_ * sizeof(touch));
+    }
+
+    // returns RGB565 display buffer written by DMA
+    auto display_buffer() const -> uint16_t const* { return buffer_; }
+
+    // returns true is SPIFFS present and initiated
+    auto spiffs_available() const -> bool override { return false; }
+
+    // read from SPIFFS 'path' maximum 'buf_len' into 'buf'
+    // returns number of bytes read or 0 if failed
+    auto spiffs_read(char const* path, char* buf, size_t buf_len) const
+        -> size_t override {
+        return 0;
+    }
+
+    // write to SPIFFS 'path' 'buf_len' bytes from 'buf', 'mode' "w" or "a" for
+    // write or append
+    // returns true if ok
+    auto spiffs_write(char const* path, char const* buf, size_t buf_len,
+                      char const* mode) const -> bool override {
+        return false;
+    }
+
+    // returns total size of SPIFFS in bytes or 0 if none present
+    auto spiffs_size_B() const -> size_t override { return 0; };
+
+    // returns number of used bytes on SPIFFS or 0 if none present
+    auto spiffs_used_B() const -> size_t override { return 0; };
+
+    // returns true if path exists
+    auto spiffs_path_exists(char const* path) const -> bool override {
+        return false;
+    }
+
+    // returns true if SD card present and initiated
+    auto sd_available() const -> bool override { return false; }
+
+    // read from SD path 'path' maximum 'buf_len' into 'buf'
+    // returns number of bytes read or 0 if failed
+    auto sd_read(char const* path, char* buf, size_t buf_len) const
+        -> size_t override {
+
+        return 0;
+    }
+
+    // write to SD 'path' 'buf_len' bytes from 'buf', 'mode' "w" or "a" for
+    // write or append returns true if ok
+    auto sd_write(char const* path, char const* buf, size_t buf_len,
+                  char const* mode) const -> bool override {
+
+        return false;
+    }
+
+    // returns total size of SD card in bytes or 0 if none present
+    auto sd_size_B() const -> size_t override { return 0; }
+
+    // returns number of bytes used on SD card or 0 if none present
+    auto sd_used_B() const -> size_t override { return 0; }
+
+    // returns true if path exists
+    auto sd_path_exists(char const* path) const -> bool override {
+        return false;
+    }
+
+  private:
+    uint16_t* buffer_{}; // RGB565 buffer written by DMA
+    dma_bus_display dma_{now_ns};
+    bool dma_crc_enabled_{};
+    uint32_t dma_crc_{};
+
+    static uint8_t constexpr max_touches = 10;
+    touch touches_[max_touches]{};
+    uint8_t touch_count_{};
+
+    static auto now_ns() -> uint64_t {
+        return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            std::chrono::steady_clock::now().time_since_epoch())
+                            .count());
+    }
+};
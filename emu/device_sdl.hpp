@@ -5,12 +5,13 @@
 
 // reviewed: 2025-11-27
 
-// note: device implementations must define global constants:
-//       `static int32_t const display_width`
-//       `static int32_t const display_height`
+// note: dimensions of the display are defined in `src/display.hpp` from
+//       `TFT_WIDTH` and `TFT_HEIGHT` of the build
 
 #include "../src/application/defs.hpp"
 #include "../src/device.hpp"
+#include "../src/display.hpp"
+#include "dma_bus.hpp"
 
 #include <SDL3/SDL.h>
 #include <SDL3/SDL_endian.h>
@@ -19,10 +20,6 @@
 #include <cstring>
 #include <stdexcept>
 
-int32_t const display_width = display_orientation == 0 ? TFT_WIDTH : TFT_HEIGHT;
-int32_t const display_height =
-    display_orientation == 0 ? TFT_HEIGHT : TFT_WIDTH;
-
 class device_sdl final : public device {
   public:
     // note: cleaning up resources omitted because device is alive during
@@ -61,9 +58,15 @@ class device_sdl final : public device {
             display_width * display_height * sizeof(uint16_t);
 
         buffer_ = new uint8_t[buffer_size]();
-        if (!buffer_) {
+        screen_buffer_ = new uint8_t[buffer_size]();
+        if (!buffer_ || !screen_buffer_) {
             throw std::runtime_error("Failed to allocate display buffer");
         }
+
+        dma_.init(reinterpret_cast<uint16_t*>(buffer_),
+                  uint32_t(display_width));
+        dma_set_write_address_window(0, 0, uint16_t(display_width),
+                                     uint16_t(display_height));
     }
 
     auto display_is_touched() -> bool override {
@@ -79,17 +82,80 @@ class device_sdl final : public device {
     }
 
     auto dma_write_bytes(uint8_t const* data, uint32_t len) -> void override {
-        std::memcpy(buffer_ + dma_offset_, data, len);
-        dma_offset_ += len;
-        if (dma_offset_ == display_width * display_height * sizeof(uint16_t)) {
+        dma_.write_bytes(data, len);
+        buffer_changed_ = true;
+    }
+
+    auto dma_is_busy() -> bool override { return dma_.is_busy(); }
+
+    auto dma_wait_for_completion() -> void override {
+        dma_.wait_for_completion();
+    }
+
+    auto dma_set_write_address_window(int16_t const x, int16_t const y,
+                                      uint16_t const w, uint16_t const h)
+        -> void override {
+        dma_.set_write_address_window(x, y, w, h);
+    }
+
+    // returns true once if 'key' was pressed since previous call
+    auto key_pressed(SDL_Keycode const key) -> bool {
+        handle_events();
+        if (key_ != key) {
+            return false;
+        }
+        key_ = 0;
+        return true;
+    }
+
+    // copies display buffer to screen if it has been written since last call
+    // note: called by emulator at end of frame
+    auto update_screen() -> void {
+        if (buffer_changed_) {
             copy_to_screen();
-            dma_offset_ = 0;
+            buffer_changed_ = false;
         }
     }
 
-    auto dma_is_busy() -> bool override { return dma_busy_; }
+    // shows false colour heatmap of the number of writes of each pixel in
+    // 'counts' instead of the display and if 'band_cycles' is not null a bar
+    // per band of 'band_height' scanlines with length relative to the slowest
+    // band
+    // note: colours from 1 write to 8 or more: blue, cyan, green, yellow,
+    //       orange, red, magenta, white
+    auto show_heatmap(uint8_t const* counts, uint32_t const* band_cycles,
+                      int32_t const band_height) -> void {
+        // RGB565 colours of 0 to 8 or more writes
+        uint16_t constexpr colours[]{0x0000, 0x001f, 0x07ff, 0x07e0, 0xffe0,
+                                     0xfc00, 0xf800, 0xf81f, 0xffff};
+        int32_t constexpr max_ix = sizeof(colours) / sizeof(colours[0]) - 1;
+        uint16_t* dst = reinterpret_cast<uint16_t*>(screen_buffer_);
+        for (int32_t i = 0; i < display_width * display_height; ++i) {
+            dst[i] = colours[counts[i] < max_ix ? counts[i] : max_ix];
+        }
 
-    auto dma_wait_for_completion() -> void override {}
+        if (band_cycles) {
+            int32_t const bands =
+                (display_height + band_height - 1) / band_height;
+            uint32_t max_cycles = 1;
+            for (int32_t i = 0; i < bands; ++i) {
+                if (band_cycles[i] > max_cycles) {
+                    max_cycles = band_cycles[i];
+                }
+            }
+            // bars are drawn in the left half of the display
+            for (int32_t y = 0; y < display_height; ++y) {
+                uint64_t const cycles = band_cycles[y / band_height];
+                int32_t const len = int32_t(
+                    cycles * uint32_t(display_width / 2) / max_cycles);
+                for (int32_t x = 0; x < len; ++x) {
+                    dst[y * display_width + x] = 0xffff;
+                }
+            }
+        }
+
+        present_screen_buffer();
+    }
 
     // returns true is SPIFFS present and initiated
     auto spiffs_available() const -> bool override { return false; }
@@ -154,13 +220,15 @@ class device_sdl final : public device {
     SDL_Window* window_{};
     SDL_Renderer* renderer_{};
     SDL_Texture* texture_{};
-    uint8_t* buffer_{}; // RGB565 buffer
-    bool dma_busy_{};
-    uint32_t dma_offset_{};
+    uint8_t* buffer_{};        // RGB565 buffer written by DMA
+    uint8_t* screen_buffer_{}; // byte swapped copy of 'buffer_'
+    bool buffer_changed_{};
+    dma_bus_display dma_{[]() -> uint64_t { return SDL_GetTicksNS(); }};
 
     static uint8_t constexpr max_touches = 10;
     touch touches_[max_touches]{};
     uint8_t touch_count_{};
+    SDL_Keycode key_{}; // last pressed key
 
     auto handle_events() -> void {
         SDL_Event event;
@@ -207,6 +275,11 @@ class device_sdl final : public device {
                 break;
             }
 
+            case SDL_EVENT_KEY_DOWN: {
+                key_ = event.key.key;
+                break;
+            }
+
             case SDL_EVENT_WINDOW_RESIZED: {
                 SDL_RenderClear(renderer_);
                 break;
@@ -220,14 +293,21 @@ class device_sdl final : public device {
 
     auto copy_to_screen() -> void {
         // byte swap to match format of resources
-        uint16_t* ptr = reinterpret_cast<uint16_t*>(buffer_);
+        // note: 'buffer_' is kept since bands may not be written every frame
+        uint16_t const* src = reinterpret_cast<uint16_t const*>(buffer_);
+        uint16_t* dst = reinterpret_cast<uint16_t*>(screen_buffer_);
         for (int32_t i = 0; i < display_width * display_height; ++i) {
-            *ptr = SDL_Swap16(*ptr);
-            ++ptr;
+            *dst = SDL_Swap16(*src);
+            ++src;
+            ++dst;
         }
 
+        present_screen_buffer();
+    }
+
+    auto present_screen_buffer() -> void {
         int32_t const pitch = display_width * sizeof(uint16_t);
-        if (!SDL_UpdateTexture(texture_, nullptr, buffer_, pitch)) {
+        if (!SDL_UpdateTexture(texture_, nullptr, screen_buffer_, pitch)) {
             throw std::runtime_error("Failed to update texture");
         }
         if (!SDL_RenderTexture(renderer_, texture_, nullptr, nullptr)) {
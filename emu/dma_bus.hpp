@@ -0,0 +1,141 @@
+#pragma once
+//
+// timing model of the bus between DMA and display used by the emulated
+// devices to simulate the time of transfers on the boards and the display
+// written by the transfers
+//
+
+// note: board selected with build flag `-D BAM_EMU_BUS_ESP32_2432S028R` or
+//       `-D BAM_EMU_BUS_JC4827W543`
+// note: `-D BAM_EMU_DMA_NS_PER_BYTE=200` gives a bus of 200 ns per byte
+//       without overhead
+// note: transfers are instant when none of the flags is defined
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+struct dma_bus {
+    char const* name;
+    uint64_t clock_hz;       // bus clock or 0 if transfers are instant
+    uint32_t data_lines;     // 1 for SPI, 4 for QSPI
+    uint32_t bits_per_pixel; // bits on the bus per RGB565 pixel
+    uint32_t transaction_ns; // overhead of queuing a transaction
+    uint32_t window_ns;      // time of setting write address window
+
+    // returns nanoseconds to transfer 'len' bytes of pixels
+    constexpr auto transfer_ns(uint32_t const len) const -> uint64_t {
+        return clock_hz ? transaction_ns +
+                              uint64_t(len) / sizeof(uint16_t) *
+                                  bits_per_pixel * 1000000000u /
+                                  (data_lines * clock_hz)
+                        : 0;
+    }
+};
+
+// ILI9341 on SPI at 55 MHz, see `SPI_FREQUENCY` in `platformio.ini`
+// note: overhead is an estimate of TFT_eSPI 'pushPixelsDMA' and
+//       'setAddrWindow'
+static dma_bus constexpr dma_bus_esp32_2432s028r{
+    "ESP32-2432S028R SPI", 55000000, 1, 16, 5000, 10000};
+
+// NV3041A on QSPI at 32 MHz, see `nv3041a_max_clock_freq` in
+// `src/devices/JC4827W543.hpp`
+// note: overhead is an estimate of 'spi_device_queue_trans' and the polled
+//       transactions of 'set_write_address_window'
+static dma_bus constexpr dma_bus_jc4827w543{"JC4827W543 QSPI", 32000000, 4,
+                                            16, 10000, 30000};
+
+#if defined(BAM_EMU_BUS_ESP32_2432S028R)
+static dma_bus constexpr dma_bus_emulated = dma_bus_esp32_2432s028r;
+#elif defined(BAM_EMU_BUS_JC4827W543)
+static dma_bus constexpr dma_bus_emulated = dma_bus_jc4827w543;
+#elif defined(BAM_EMU_DMA_NS_PER_BYTE)
+static dma_bus constexpr dma_bus_emulated{
+    "custom", 8000000000u / BAM_EMU_DMA_NS_PER_BYTE, 1, 16, 0, 0};
+#else
+static dma_bus constexpr dma_bus_emulated{"instant", 0, 1, 16, 0, 0};
+#endif
+
+// display written by DMA in a write address window over 'dma_bus_emulated'
+// note: shared by the emulated devices so that the emulator and the benchmark
+//       runner write the same pixels with the same timing
+class dma_bus_display final {
+  public:
+    // 'now_ns' returns nanoseconds since an arbitrary point in time
+    explicit dma_bus_display(uint64_t (*now_ns)()) : now_ns_{now_ns} {}
+
+    // sets the RGB565 buffer of 'width' pixels per row written by transfers
+    auto init(uint16_t* pixels, uint32_t const width) -> void {
+        pixels_ = pixels;
+        width_ = width;
+    }
+
+    // writes 'len' bytes of pixels from 'data' to the write address window
+    // continuing where previous write ended
+    // note: transfer completes asynchronously after the modeled time
+    auto write_bytes(uint8_t const* data, uint32_t const len) -> void {
+        wait_for_completion();
+
+        // write rows of pixels in the write address window
+        uint32_t remaining_px = len / sizeof(uint16_t);
+        while (remaining_px) {
+            uint32_t const window_x = window_px_ % window_w_;
+            uint32_t const window_y = window_px_ / window_w_;
+            uint32_t const n =
+                remaining_px < window_w_ - window_x ? remaining_px
+                                                    : window_w_ - window_x;
+            size_t const offset =
+                (window_y_ + window_y) * width_ + window_x_ + window_x;
+            memcpy(pixels_ + offset, data, n * sizeof(uint16_t));
+            data += n * sizeof(uint16_t);
+            remaining_px -= n;
+            window_px_ += n;
+            if (window_px_ == window_w_ * window_h_) {
+                window_px_ = 0;
+            }
+        }
+
+        if (dma_bus_emulated.clock_hz) {
+            busy_until_ns_ = now_ns_() + dma_bus_emulated.transfer_ns(len);
+        }
+    }
+
+    auto is_busy() const -> bool {
+        return dma_bus_emulated.clock_hz && now_ns_() < busy_until_ns_;
+    }
+
+    auto wait_for_completion() const -> void {
+        while (is_busy()) {
+        }
+    }
+
+    // sets the area of the display written by following 'write_bytes'
+    // note: the commands setting the window are not asynchronous
+    auto set_write_address_window(int16_t const x, int16_t const y,
+                                  uint16_t const w, uint16_t const h) -> void {
+        wait_for_completion();
+        window_x_ = uint32_t(x);
+        window_y_ = uint32_t(y);
+        window_w_ = w;
+        window_h_ = h;
+        window_px_ = 0;
+        if (dma_bus_emulated.clock_hz) {
+            busy_until_ns_ = now_ns_() + dma_bus_emulated.window_ns;
+            wait_for_completion();
+        }
+    }
+
+  private:
+    uint64_t (*now_ns_)();
+    uint16_t* pixels_{};
+    uint32_t width_{};
+    uint64_t busy_until_ns_{}; // simulated transfer in progress until
+
+    // write address window and number of pixels written in it
+    uint32_t window_x_{};
+    uint32_t window_y_{};
+    uint32_t window_w_{};
+    uint32_t window_h_{};
+    uint32_t window_px_{};
+};
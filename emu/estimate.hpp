@@ -0,0 +1,147 @@
+#pragma once
+//
+// estimate of frame time on the boards from the operations counted by a run
+// on the host and a table of cycles per operation of each board
+//
+
+// note: operations are counted when built with `-D BAM_OP_COUNTERS`
+// note: cycles are calibrated to roughly reproduce the frame rates noted at
+//       'dma_n_scanlines' in `renderer.hpp` with the default application
+//       and should be re-calibrated with the profiler when the renderer
+//       changes substantially
+// note: estimates of a board are accurate when the emulator is built with
+//       the display size of the board, e.g. `TFT_WIDTH=480` and
+//       `TFT_HEIGHT=272` for JC4827W543
+
+#include "../src/counters.hpp"
+#include "dma_bus.hpp"
+
+#include <cstdint>
+
+struct estimate_board {
+    char const* name;
+    dma_bus const* bus;
+    uint32_t cpu_mhz;
+    // cycles of CPU per counted operation
+    // note: 'dma_bytes' is in the time of the bus, not the CPU
+    uint16_t cycles[counter_count];
+};
+
+static_assert(counter_count == 12, "update cycles of 'estimate_boards'");
+
+static estimate_board constexpr estimate_boards[]{
+    // ESP32 with tile and sprite images read through flash cache
+    {"ESP32-2432S028R",
+     &dma_bus_esp32_2432s028r,
+     240,
+     {40, 40, 40, 40, 20, 10, 10, 30, 2000, 0, 400, 100}},
+    // ESP32-S3
+    {"JC4827W543",
+     &dma_bus_jc4827w543,
+     240,
+     {16, 16, 16, 20, 10, 5, 5, 15, 2000, 0, 250, 60}},
+};
+
+// returns true if operation 'c' is done by the engine and not the renderer
+static auto constexpr estimate_is_engine(int32_t const c) -> bool {
+    return c == counter_updates || c == counter_pre_renders;
+}
+
+// modes of the engine in which rendering, DMA transfers and update of
+// objects overlap differently
+enum estimate_mode : uint8_t {
+    estimate_serial,
+    estimate_pipelined,
+    estimate_cooperative
+};
+
+static auto constexpr estimate_max(uint64_t const a, uint64_t const b)
+    -> uint64_t {
+    return a > b ? a : b;
+}
+
+// returns microseconds the renderer waits for the DMA in a frame
+static auto constexpr estimate_dma_wait_us(uint64_t const render_us,
+                                           uint64_t const dma_us) -> uint64_t {
+    return dma_us > render_us ? dma_us - render_us : 0;
+}
+
+// returns microseconds of a frame in 'mode' from the microseconds of
+// rendering, DMA transfers and engine
+// note: rendering overlaps the DMA transfers
+// note: when pipelined the update of objects overlaps rendering
+// note: when cooperative the update slices run while the renderer waits for
+//       the DMA thus only engine time exceeding the wait is added
+static auto constexpr estimate_combine_us(estimate_mode const mode,
+                                          uint64_t const render_us,
+                                          uint64_t const dma_us,
+                                          uint64_t const engine_us)
+    -> uint64_t {
+    return mode == estimate_pipelined
+               ? estimate_max(estimate_max(render_us, dma_us), engine_us)
+           : mode == estimate_cooperative
+               ? estimate_max(render_us, dma_us) +
+                     estimate_max(engine_us, estimate_dma_wait_us(
+                                                 render_us, dma_us)) -
+                     estimate_dma_wait_us(render_us, dma_us)
+               : estimate_max(render_us, dma_us) + engine_us;
+}
+
+// note: render 10, DMA 15 thus 5 us waiting for DMA
+static_assert(estimate_combine_us(estimate_serial, 10, 15, 4) == 19,
+              "serial adds engine");
+static_assert(estimate_combine_us(estimate_pipelined, 10, 15, 4) == 15,
+              "pipelined hides engine shorter than render and DMA");
+static_assert(estimate_combine_us(estimate_pipelined, 10, 15, 20) == 20,
+              "pipelined is bound by engine");
+static_assert(estimate_combine_us(estimate_cooperative, 10, 15, 4) == 15,
+              "cooperative hides engine shorter than DMA wait");
+static_assert(estimate_combine_us(estimate_cooperative, 10, 15, 8) == 18,
+              "cooperative adds engine exceeding DMA wait");
+static_assert(estimate_combine_us(estimate_cooperative, 15, 10, 4) == 19,
+              "cooperative adds engine when DMA is not waited for");
+
+// mode of the build
+static estimate_mode constexpr estimate_engine_mode =
+    engine_pipelined     ? estimate_pipelined
+    : engine_cooperative ? estimate_cooperative
+                         : estimate_serial;
+
+// returns estimated microseconds of a frame on 'board' given operations per
+// frame 'ops'
+// note: when 'render_parallel' the rendering is assumed to be evenly split
+//       between the cores
+static auto estimate_frame_us(estimate_board const& board,
+                              uint32_t const ops[counter_count]) -> uint32_t {
+    uint64_t render_cycles = 0;
+    uint64_t engine_cycles = 0;
+    for (int32_t i = 0; i < counter_count; ++i) {
+        uint64_t const cycles = uint64_t(ops[i]) * board.cycles[i];
+        if (estimate_is_engine(i)) {
+            engine_cycles += cycles;
+        } else {
+            render_cycles += cycles;
+        }
+    }
+    uint64_t const render_us =
+        render_cycles / uint64_t(render_workers_count) / board.cpu_mhz;
+    uint64_t const engine_us = engine_cycles / board.cpu_mhz;
+    uint32_t const transfers = ops[counter_dma_transfers];
+    uint64_t const dma_us =
+        transfers ? board.bus->transfer_ns(ops[counter_dma_bytes] / transfers) *
+                        transfers / 1000
+                  : 0;
+    return uint32_t(estimate_combine_us(estimate_engine_mode, render_us,
+                                        dma_us, engine_us));
+}
+
+// returns estimated frames per second on 'board' from the average operations
+// per frame since last 'counters_clear()'
+static auto estimate_fps(estimate_board const& board) -> uint32_t {
+    uint32_t ops[counter_count];
+    for (int32_t i = 0; i < counter_count; ++i) {
+        ops[i] = counters_avg(counter(i));
+    }
+    uint32_t const us = estimate_frame_us(board, ops);
+    return us ? 1000000 / us : 0;
+}
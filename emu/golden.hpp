@@ -0,0 +1,155 @@
+#pragma once
+//
+// input scripts and golden frame files used by the benchmark runner to
+// verify that rendering and collisions are unchanged
+//
+
+// note: input script is a text file with lines of
+//       `<first frame> <last frame> <x> <y>`
+//       where the display is touched at raw touch coordinates 'x', 'y' from
+//       'first frame' to 'last frame' inclusive
+//       empty lines and lines starting with '#' are ignored
+
+// note: golden file is a text file with one line per frame of
+//       `<frame> <dma crc32> <collisions crc32>`
+//       in hexadecimal where 'dma' is the write address windows and pixels
+//       sent to the display during the frame and 'collisions' are the
+//       'col_with' of objects after render
+// note: skipping unchanged bands sends less to the display and has its own
+//       golden file
+
+#include "../src/device.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+// touch during a range of frames
+struct golden_touch {
+    int32_t first_frame;
+    int32_t last_frame;
+    int16_t x;
+    int16_t y;
+};
+
+// checksums of a frame
+struct golden_frame {
+    uint32_t dma;
+    uint32_t collisions;
+};
+
+// returns crc32 of 'n' bytes at 'data' continuing from 'crc'
+// note: start with 'crc' 0
+static auto golden_crc32(uint32_t crc, void const* data, size_t const n)
+    -> uint32_t {
+    static uint32_t table[256];
+    if (!table[1]) {
+        for (uint32_t i = 0; i < 256; ++i) {
+            uint32_t c = i;
+            for (int32_t k = 0; k < 8; ++k) {
+                c = c & 1 ? 0xedb88320u ^ (c >> 1) : c >> 1;
+            }
+            table[i] = c;
+        }
+    }
+    uint8_t const* p = static_cast<uint8_t const*>(data);
+    crc = ~crc;
+    for (size_t i = 0; i < n; ++i) {
+        crc = table[(crc ^ p[i]) & 0xff] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+// reads input script from 'path' into 'touches'
+// returns false if file could not be read or has invalid line
+static auto golden_load_input(char const* path,
+                              std::vector<golden_touch>& touches) -> bool {
+    FILE* f = fopen(path, "r");
+    if (!f) {
+        return false;
+    }
+    char line[256];
+    bool ok = true;
+    while (fgets(line, sizeof(line), f)) {
+        if (line[0] == '#' || line[0] == '\n') {
+            continue;
+        }
+        int32_t first = 0;
+        int32_t last = 0;
+        int32_t x = 0;
+        int32_t y = 0;
+        if (sscanf(line, "%d %d %d %d", &first, &last, &x, &y) != 4) {
+            printf("!!! invalid line in '%s': %s", path, line);
+            ok = false;
+            break;
+        }
+        touches.push_back(golden_touch{first, last, int16_t(x), int16_t(y)});
+    }
+    fclose(f);
+    return ok;
+}
+
+// writes to 'touches' the touches at 'frame' from 'script'
+// returns number of touches
+static auto golden_touches_at(std::vector<golden_touch> const& script,
+                              int32_t const frame, device::touch touches[],
+                              uint8_t const max_touches) -> uint8_t {
+    uint8_t count = 0;
+    for (golden_touch const& t : script) {
+        if (count == max_touches) {
+            break;
+        }
+        if (frame >= t.first_frame && frame <= t.last_frame) {
+            touches[count].x = t.x;
+            touches[count].y = t.y;
+            touches[count].pressure = 255;
+            ++count;
+        }
+    }
+    return count;
+}
+
+// reads golden file from 'path' into 'frames'
+// returns false if file could not be read or has invalid line
+static auto golden_load(char const* path, std::vector<golden_frame>& frames)
+    -> bool {
+    FILE* f = fopen(path, "r");
+    if (!f) {
+        return false;
+    }
+    char line[256];
+    bool ok = true;
+    while (fgets(line, sizeof(line), f)) {
+        if (line[0] == '#' || line[0] == '\n') {
+            continue;
+        }
+        int32_t frame = 0;
+        uint32_t dma = 0;
+        uint32_t collisions = 0;
+        if (sscanf(line, "%d %x %x", &frame, &dma, &collisions) != 3 ||
+            frame != int32_t(frames.size())) {
+            printf("!!! invalid line in '%s': %s", path, line);
+            ok = false;
+            break;
+        }
+        frames.push_back(golden_frame{dma, collisions});
+    }
+    fclose(f);
+    return ok;
+}
+
+// writes 'frames' to golden file 'path'
+// returns false if file could not be written
+static auto golden_write(char const* path,
+                         std::vector<golden_frame> const& frames) -> bool {
+    FILE* f = fopen(path, "w");
+    if (!f) {
+        return false;
+    }
+    fprintf(f, "# frame dma collisions\n");
+    for (size_t i = 0; i < frames.size(); ++i) {
+        fprintf(f, "%zu %08x %08x\n", i, frames[i].dma,
+                frames[i].collisions);
+    }
+    return fclose(f) == 0;
+}
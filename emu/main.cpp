@@ -15,6 +15,8 @@
 #include "../src/renderer.hpp"
 // then the main entry file to user code
 #include "../src/application/application.hpp"
+// then the estimate of frame time on the boards
+#include "estimate.hpp"
 
 // instantiate the device implementation
 static device_sdl device;
@@ -23,12 +25,10 @@ static device_sdl device;
 auto millis() -> unsigned long { return SDL_GetTicks(); }
 
 // functions used in `renderer.hpp` to decouple from device implementation
-auto device_dma_write_bytes(uint8_t const* data, uint32_t len) -> void {
-    device.dma_write_bytes(data, len);
-}
-auto device_dma_is_busy() -> bool { return false; };
-auto device_alloc_dma_buffer(uint32_t n) -> void* { return calloc(1, n); }
-auto device_alloc_internal_buffer(uint32_t n) -> void* { return calloc(1, n); }
+#include "device_functions.hpp"
+
+auto device_micros() -> uint32_t { return uint32_t(SDL_GetTicksNS() / 1000); }
+auto device_engine_stage_done(engine_stage /*unused*/) -> void {}
 
 auto setup() -> void {
     printf("------------------- object sizes -------------------------\n");
@@ -50,6 +50,7 @@ auto setup() -> void {
     device.init();
 
     printf("------------------- peripherals --------------------------\n");
+    printf("           DMA bus: %s\n", dma_bus_emulated.name);
     printf("           SD card: %s\n",
            device.sd_available() ? "present" : "n/a");
     printf("              size: %zu B\n", device.sd_size_B());
@@ -61,6 +62,14 @@ auto setup() -> void {
 
     renderer_init();
 
+    if (render_bench_spans_at_setup) {
+        render_bench_spans();
+    }
+
+    if (render_parallel || engine_pipelined) {
+        std::thread{render_worker_thread}.detach();
+    }
+
     // initiate clock
     clk.init(clk::time(millis()), clk_fps_update_ms, clk_locked_dt_ms);
     // note: not in 'engine_init()' due to dependency on 'millis()'
@@ -69,20 +78,37 @@ auto setup() -> void {
 
     application_init();
 
-    printf("------------------- on heap ------------------------------\n");
-    printf("   DMA buf 1 and 2: %u B\n", 2 * dma_buffers.buf_size_B);
-    printf("      sprites data: %d B\n", sprites.allocated_data_size_B());
-    printf("      objects data: %d B\n", objects.allocated_data_size_B());
-    printf("     collision map: %u B\n", collision_map_size_B);
+    memory_dump();
+    printf("        host arena: %zu of %zu B\n", device_arena_used_B,
+           sizeof(device_arena));
     printf("------------------- after setup --------------------------\n");
 }
 
+// time spent in 'loop()' since previous status output
+// note: measures throughput since frames per second is capped
+static unsigned long loop_ms;
+static unsigned long loop_count;
+
+// 0: display, 1: overdraw heatmap, 2: heatmap with render time of bands
+// note: cycled by pressing 'h' when 'render_overdraw'
+static int32_t heatmap_mode;
+
 auto loop() -> void {
     if (clk.on_frame(clk::time(millis()))) {
         // note: not in 'engine_loop()' due to dependency on 'millis()'
-        printf("t=%06u  fps=%02d  dma=%03d  objs=%03d  sprs=%03d\n", clk.ms,
-               clk.fps, dma_busy * 100 / (dma_writes ? dma_writes : 1),
+        printf("t=%06u  fps=%02d  ms=%02lu  dma=%03d  skip=%02d  objs=%03d  "
+               "sprs=%03d\n",
+               clk.ms, clk.fps, loop_ms / (loop_count ? loop_count : 1),
+               dma_busy * 100 / (dma_writes ? dma_writes : 1), dma_skips,
                objects.allocated_list_len(), sprites.allocated_list_len());
+        loop_ms = loop_count = 0;
+        if (counters_enabled) {
+            for (estimate_board const& board : estimate_boards) {
+                printf("  estimated fps on %s: %u\n", board.name,
+                       estimate_fps(board));
+            }
+            counters_clear();
+        }
     }
 
     if (device.display_is_touched()) {
@@ -92,7 +118,39 @@ auto loop() -> void {
         application_on_touch(touches, touch_count > 10 ? 10 : touch_count);
     }
 
+    if (profiler_enabled && device.key_pressed(SDLK_P)) {
+        // note: profiler statistics dumped on demand by pressing 'p'
+        profiler_dump();
+    }
+
+    if (render_overdraw && device.key_pressed(SDLK_H)) {
+        // note: pressing 'h' cycles through display, overdraw heatmap and
+        //       heatmap with render time of bands
+        heatmap_mode = (heatmap_mode + 1) % 3;
+        printf("heatmap mode: %s\n",
+               heatmap_mode == 0   ? "off"
+               : heatmap_mode == 1 ? "overdraw"
+                                   : "overdraw and band render time");
+    }
+
+    if (trace_enabled && device.key_pressed(SDLK_T)) {
+        // note: trace written on demand by pressing 't'
+        if (trace_export("trace.json")) {
+            printf("trace written to 'trace.json'\n");
+        } else {
+            printf("!!! could not write 'trace.json'\n");
+        }
+    }
+
     engine_loop();
+
+    if (heatmap_mode) {
+        device.show_heatmap(render_overdraw_map,
+                            heatmap_mode == 2 ? render_band_cycles : nullptr,
+                            dma_n_scanlines);
+    } else {
+        device.update_screen();
+    }
 }
 
 auto main() -> int {
@@ -101,6 +159,8 @@ auto main() -> int {
         unsigned long const t0 = millis();
         loop();
         unsigned long const dt = millis() - t0;
+        loop_ms += dt;
+        ++loop_count;
         if (BAM_TIME_STEP_MS > dt) {
             SDL_Delay(Uint32(BAM_TIME_STEP_MS - dt));
         }
@@ -0,0 +1,17 @@
+#!/bin/bash
+set -e
+cd $(dirname "$0")
+
+g++ -std=gnu++11 -O3 -g3 -o bench-o1store \
+    -Wfatal-errors -Werror -Wall -Wextra -Wpedantic \
+    -Wshadow -Wnon-virtual-dtor -Woverloaded-virtual -Wcast-align \
+    -Wold-style-cast -Wconversion -Wsign-conversion -Wmisleading-indentation \
+    -Wduplicated-cond -Wduplicated-branches -Wlogical-op -Wuseless-cast \
+    -Wdouble-promotion -Wformat=2 -Wimplicit-fallthrough -Wpointer-arith \
+    -Wswitch-enum -Wvla -Wsuggest-final-types -Wsuggest-final-methods \
+    -Wsuggest-override -Wno-unused-parameter -Wno-unused-variable \
+    -flifetime-dse=1 \
+    "$@" bench-o1store.cpp
+
+# note: micro benchmark of 'o1store' without the engine
+# note: additional arguments are passed to the compiler
@@ -0,0 +1,21 @@
+#!/bin/bash
+set -e
+cd $(dirname "$0")
+
+g++ -std=gnu++11 -O3 -g3 -pthread -o bench \
+    -Wfatal-errors -Werror -Wall -Wextra -Wpedantic \
+    -Wshadow -Wnon-virtual-dtor -Woverloaded-virtual -Wcast-align \
+    -Wold-style-cast -Wconversion -Wsign-conversion -Wmisleading-indentation \
+    -Wduplicated-cond -Wduplicated-branches -Wlogical-op -Wuseless-cast \
+    -Wdouble-promotion -Wformat=2 -Wimplicit-fallthrough -Wpointer-arith \
+    -Wswitch-enum -Wvla -Wsuggest-final-types -Wsuggest-final-methods \
+    -Wsuggest-override -Wno-unused-parameter -Wno-unused-variable \
+    -flifetime-dse=1 \
+    -DTOUCH_MIN_X=0 -DTOUCH_MAX_X=240 -DTOUCH_MIN_Y=0 -DTOUCH_MAX_Y=320 \
+    -DTFT_WIDTH=240 -DTFT_HEIGHT=320 \
+    -DBAM_TIME_STEP_MS=33 -DBAM_STAGE_TIMING \
+    "$@" bench.cpp
+
+# note: same as `make.sh` without SDL3 and with stage timing
+# note: additional arguments are passed to the compiler such as
+#       `./make-bench.sh -DBAM_PARALLEL_RENDER`
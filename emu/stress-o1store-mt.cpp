@@ -0,0 +1,219 @@
+//
+// stress test of 'o1store_mt' where threads allocate and free instances
+// concurrently every frame and the main thread applies the changes and checks
+// the invariants of the store between frames
+// see `make-stress-o1store-mt.sh`
+//
+
+#include "../src/o1store_mt.hpp"
+
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <thread>
+
+// instance with owner written at allocation
+class item final {
+  public:
+    item** alloc_ptr;
+    // note: no default value since it would overwrite the 'o1store_mt'
+    //       assigned value at 'alloc()'
+    int32_t owner{};
+    int32_t frame{};
+    bool freed{};
+
+    // note: user provided constructor so that 'item{}' does not zero
+    //       'alloc_ptr'
+    item() {}
+};
+
+static int32_t constexpr store_size = 1024;
+static int32_t constexpr threads_count = 4;
+
+using item_store =
+    o1store_mt<item, store_size, 0, 0, o1store_calloc, threads_count, 16>;
+
+static item_store store;
+
+// barrier of the worker threads and the main thread
+class barrier final {
+    std::mutex mutex_;
+    std::condition_variable cond_;
+    int32_t const count_;
+    int32_t waiting_ = 0;
+    int32_t generation_ = 0;
+
+  public:
+    explicit barrier(int32_t const count) : count_{count} {}
+
+    auto wait() -> void {
+        std::unique_lock<std::mutex> lock{mutex_};
+        int32_t const gen = generation_;
+        ++waiting_;
+        if (waiting_ == count_) {
+            waiting_ = 0;
+            ++generation_;
+            cond_.notify_all();
+            return;
+        }
+        cond_.wait(lock, [this, gen] { return gen != generation_; });
+    }
+};
+
+static barrier frame_barrier{threads_count + 1};
+static int32_t frames = 20000;
+
+// instances allocated by each thread in current frame
+struct thread_state {
+    item* allocated[store_size];
+    int32_t allocated_len;
+    // instances freed from the allocated list
+    int32_t freed_len;
+    // instances allocated and freed in the same frame
+    int32_t freed_new_len;
+    int32_t alloc_failed;
+};
+
+static thread_state states[threads_count];
+
+static auto rnd(uint32_t& state, uint32_t const n) -> uint32_t {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state % n;
+}
+
+// frees about a fifth of the allocated instances it owns by position in the
+// allocated list, allocates a random number of instances and frees some of
+// them in the same frame
+static auto worker(int32_t const t) -> void {
+    uint32_t rnd_state = uint32_t(t + 1) * 2654435761U;
+    thread_state& st = states[t];
+    for (int32_t f = 0; f < frames; ++f) {
+        frame_barrier.wait();
+        st.allocated_len = st.freed_len = st.freed_new_len = 0;
+        st.alloc_failed = 0;
+        // note: allocated list is not changed during the frame
+        item** list = store.allocated_list();
+        int32_t const len = store.allocated_list_len();
+        for (int32_t i = t; i < len; i += threads_count) {
+            if (rnd(rnd_state, 5) == 0) {
+                list[i]->freed = true;
+                store.free(list[i]);
+                ++st.freed_len;
+            }
+        }
+        uint32_t const n_max = uint32_t(2 * len / (5 * threads_count) + 8);
+        int32_t const n = int32_t(rnd(rnd_state, n_max));
+        for (int32_t i = 0; i < n; ++i) {
+            item* it = store.alloc(t);
+            if (!it) {
+                ++st.alloc_failed;
+                break;
+            }
+            new (it) item{};
+            it->owner = t;
+            it->frame = f;
+            if (rnd(rnd_state, 8) == 0) {
+                it->freed = true;
+                store.free(it);
+                ++st.freed_new_len;
+                continue;
+            }
+            st.allocated[st.allocated_len] = it;
+            ++st.allocated_len;
+        }
+        frame_barrier.wait();
+    }
+}
+
+static auto fail(int32_t const f, char const* msg) -> void {
+    printf("!!! frame %d: %s\n", f, msg);
+    exit(1);
+}
+
+// checks the invariants of the store after 'apply_free()'
+static auto check(int32_t const f, int32_t const expected_len) -> void {
+    static int32_t marks[store_size];
+    int32_t const len = store.allocated_list_len();
+    if (len != expected_len) {
+        fail(f, "unexpected allocated list length");
+    }
+    if (len + store.free_count() != store_size) {
+        fail(f, "instances lost or duplicated");
+    }
+    item** list = store.allocated_list();
+    for (int32_t i = 0; i < len; ++i) {
+        item* it = list[i];
+        if (it->alloc_ptr != &list[i]) {
+            fail(f, "inconsistent 'alloc_ptr'");
+        }
+        if (it->freed) {
+            fail(f, "freed instance in allocated list");
+        }
+        int32_t const ix = store.instance_ix(it);
+        if (marks[ix] == f + 1) {
+            fail(f, "duplicate instance in allocated list");
+        }
+        marks[ix] = f + 1;
+    }
+    for (thread_state const& st : states) {
+        for (int32_t i = 0; i < st.allocated_len; ++i) {
+            item const* it = st.allocated[i];
+            if (it->owner != &st - states || it->frame != f) {
+                fail(f, "instance allocated by two threads");
+            }
+            if (marks[store.instance_ix(it)] != f + 1) {
+                fail(f, "allocated instance not in allocated list");
+            }
+        }
+    }
+}
+
+auto main(int argc, char** argv) -> int {
+    if (argc > 2 && !strcmp(argv[1], "-f")) {
+        frames = atoi(argv[2]);
+    }
+
+    std::thread workers[threads_count];
+    for (int32_t t = 0; t < threads_count; ++t) {
+        workers[t] = std::thread{worker, t};
+    }
+
+    int64_t allocs = 0;
+    int64_t frees = 0;
+    int32_t full_frames = 0;
+    int32_t max_len = 0;
+    for (int32_t f = 0; f < frames; ++f) {
+        frame_barrier.wait();
+        // note: threads allocate and free
+        frame_barrier.wait();
+        int32_t len = store.allocated_list_len();
+        bool full = false;
+        for (thread_state const& st : states) {
+            len += st.allocated_len - st.freed_len;
+            allocs += st.allocated_len + st.freed_new_len;
+            frees += st.freed_len + st.freed_new_len;
+            full = full || st.alloc_failed != 0;
+        }
+        store.apply_free();
+        check(f, len);
+        full_frames += full ? 1 : 0;
+        max_len = len > max_len ? len : max_len;
+    }
+
+    for (std::thread& w : workers) {
+        w.join();
+    }
+
+    printf("frames: %d  threads: %d  allocs: %lld  frees: %lld  "
+           "full: %d  max: %d\n",
+           frames, threads_count, static_cast<long long>(allocs),
+           static_cast<long long>(frees), full_frames, max_len);
+    printf("ok\n");
+    return 0;
+}
@@ -0,0 +1,29 @@
+#!/bin/bash
+set -e -o pipefail
+cd $(dirname "$0")
+
+# verifies that all render modes give the golden frames of the input script
+# note: pipelined and cooperative update handle collisions one frame later and
+#       have their own golden file
+# note: skipping unchanged bands sends less to the display and has its own
+#       golden file
+
+verify() {
+    local golden=$1
+    shift
+    echo "--- $* $golden"
+    ./make-bench.sh "$@"
+    ./bench -i golden/input.txt -g "golden/$golden" -o /dev/null |
+        grep -E "^(all|!!!)"
+}
+
+verify golden.txt
+verify golden.txt -DBAM_VERIFY_COLLISION_MAP
+verify golden-skip.txt -DBAM_SKIP_UNCHANGED_BANDS
+verify golden.txt -DBAM_PARALLEL_RENDER
+verify golden.txt -DBAM_TILE_ROW_CACHE
+verify golden.txt -DBAM_SPRITE_OPAQUE_RUNS
+verify golden-skip.txt -DBAM_INDEXED_COMPOSITE -DBAM_SKIP_UNCHANGED_BANDS
+verify golden.txt -DBAM_FRONT_TO_BACK -DBAM_TILE_ROW_CACHE
+verify golden-deferred.txt -DBAM_PIPELINED_UPDATE
+verify golden-deferred.txt -DBAM_COOPERATIVE_UPDATE -DBAM_EMU_DMA_NS_PER_BYTE=20
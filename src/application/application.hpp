@@ -48,21 +48,26 @@ inline auto application_init() -> void {
             object_instance_max_size_B,
         "game object size larger than the specified maximum size");
 
+    // assert that the most frequent game objects fit the smallest size class
+    static_assert(max_size_of_type<bullet, fragment>() <=
+                      size_t(object_pool_sizes_B[0]),
+                  "bullet or fragment larger than the smallest size class");
+
     // scrolling vertically from bottom up
     tile_map_y = tile_map_height * tile_height - display_height;
     tile_map_dy = -16;
 
-    ben* bn = new (objects.alloc()) ben{};
+    ben* bn = new (objects.alloc(sizeof(ben))) ben{};
     bn->x = 0;
     bn->y = 80;
 
-    ned* nd = new (objects.alloc()) ned{};
+    ned* nd = new (objects.alloc(sizeof(ned))) ned{};
     nd->x = display_width - sprite_width;
     nd->y = 80;
     nd->moving_direction = -1;
 
     // create default hero
-    hero* hro = new (objects.alloc()) hero{};
+    hero* hro = new (objects.alloc(sizeof(hero))) hero{};
     hro->x = float(display_width) / 2 - float(sprite_width) / 2;
     hro->y = 30;
 
@@ -88,7 +93,7 @@ inline auto application_on_touch(device::touch const touches[],
 
         last_fire_ms = clk.ms;
         for (uint8_t i = 0; i < count; ++i) {
-            if (object* mem = objects.alloc()) {
+            if (object* mem = objects.alloc(sizeof(bullet))) {
                 bullet* blt = new (mem) bullet{};
                 blt->x =
                     display_x_for_touch(touches[i].x) - float(sprite_width) / 2;
@@ -184,7 +189,7 @@ inline auto application_on_frame_completed() -> void {
     }
 
     if (!state.hero_is_alive) {
-        hero* hro = new (objects.alloc()) hero{};
+        hero* hro = new (objects.alloc(sizeof(hero))) hero{};
         hro->x = random_float(0, display_width);
         hro->y = 30;
         hro->dx = random_float(-64, 64);
@@ -208,7 +213,7 @@ static auto wave_1() -> void {
     float x = 0;
     float y = -sprite_height;
     for (int32_t i = 0; i < count; ++i) {
-        ship1* shp = new (objects.alloc()) ship1{};
+        ship1* shp = new (objects.alloc(sizeof(ship1))) ship1{};
         shp->x = x;
         shp->y = y;
         shp->dy = 50;
@@ -223,7 +228,7 @@ static auto wave_2() -> void {
     float x = 0;
     float y = -sprite_height;
     for (int32_t i = 0; i < count; ++i, x += dx) {
-        ship1* shp = new (objects.alloc()) ship1{};
+        ship1* shp = new (objects.alloc(sizeof(ship1))) ship1{};
         shp->x = x;
         shp->y = y;
         shp->dy = 50;
@@ -238,7 +243,7 @@ static auto wave_3() -> void {
     for (int32_t j = 0; j < count_y; ++j, y -= 24) {
         float x = 0;
         for (int32_t i = 0; i < count_x; ++i, x += dx) {
-            ship1* shp = new (objects.alloc()) ship1{};
+            ship1* shp = new (objects.alloc(sizeof(ship1))) ship1{};
             shp->x = x;
             shp->y = y;
             shp->dy = 50;
@@ -247,13 +252,13 @@ static auto wave_3() -> void {
 }
 
 static auto wave_4() -> void {
-    ufo2* ufo = new (objects.alloc()) ufo2{};
+    ufo2* ufo = new (objects.alloc(sizeof(ufo2))) ufo2{};
     ufo->x = float(display_width) / 2;
     ufo->y = -sprite_height;
     ufo->dy = 5;
 
     {
-        ship2* shp = new (objects.alloc()) ship2{};
+        ship2* shp = new (objects.alloc(sizeof(ship2))) ship2{};
         shp->x = -sprite_width;
         shp->y = -sprite_height;
         shp->dy = 25;
@@ -262,7 +267,7 @@ static auto wave_4() -> void {
         shp->ddx = 10;
     }
     {
-        ship2* shp = new (objects.alloc()) ship2{};
+        ship2* shp = new (objects.alloc(sizeof(ship2))) ship2{};
         shp->x = display_width;
         shp->y = -sprite_height;
         shp->dy = 25;
@@ -278,7 +283,7 @@ static auto wave_5() -> void {
     for (int32_t j = 0; j < 12; ++j, y -= 16) {
         float x = 0;
         for (int32_t i = 0; i < 19; ++i, x += dx) {
-            ship1* shp = new (objects.alloc()) ship1{};
+            ship1* shp = new (objects.alloc(sizeof(ship1))) ship1{};
             shp->x = x;
             shp->y = y;
             shp->dy = 30;
@@ -79,7 +79,7 @@ static int32_t constexpr sprite_height = 16;
 static int32_t constexpr sprite_layer_count = 3;
 
 // type used to index a 'sprite'
-// note: 8-bit for 'collision_map' to fit in a contiguous block on heap
+// note: 8-bit to keep 'collision_map' and render lists small
 using sprite_ix = uint8_t;
 
 // sprites available for allocation using 'sprites'
@@ -88,7 +88,8 @@ using sprite_ix = uint8_t;
 static int32_t constexpr sprite_count = 255;
 
 // objects available for allocation using 'objects'
-static int32_t constexpr object_count = 255;
+// note: sum of 'object_pool_counts'
+static int32_t constexpr object_count = 351;
 
 // used by 'engine.hpp' as seed for random numbers
 static int32_t constexpr random_seed = 0;
@@ -113,6 +114,20 @@ enum object_class : uint8_t {
 // size that fits any instance of game object
 static int32_t constexpr object_instance_max_size_B = 128;
 
+// number of size classes of game object instances
+static int32_t constexpr object_pools_count = 2;
+
+// size of instances in each size class in ascending order
+// note: an instance is allocated from the smallest size class that fits it and
+//       from a larger one when that is exhausted
+// note: the small class fits 'bullet' and 'fragment' on device and emulator
+static int32_t constexpr object_pool_sizes_B[object_pools_count]{
+    80, object_instance_max_size_B};
+
+// number of instances in each size class
+// note: same memory as 255 instances of 'object_instance_max_size_B'
+static int32_t constexpr object_pool_counts[object_pools_count]{256, 95};
+
 // define the size of collision bits
 using collision_bits = uint16_t;
 
@@ -33,7 +33,7 @@ class bullet final : public game_object {
     }
 
     auto on_death_by_collision() -> void override {
-        fragment* frg = new (objects.alloc()) fragment{};
+        fragment* frg = new (objects.alloc(sizeof(fragment))) fragment{};
         frg->die_at_ms = clk.ms + 250;
         frg->x = x;
         frg->y = y;
@@ -66,7 +66,7 @@ class hero final : public game_object {
         }
 
         if (clk.ms - last_upgrade_deployed_ms_ > upgrade_deploy_interval_ms_) {
-            upgrade* upg = new (objects.alloc()) upgrade{};
+            upgrade* upg = new (objects.alloc(sizeof(upgrade))) upgrade{};
             upg->x = x;
             upg->y = y;
             upg->dy = 30;
@@ -51,7 +51,7 @@ class ship2 final : public game_object {
     }
 
     auto on_death_by_collision() -> void override {
-        upgrade* upg = new (objects.alloc()) upgrade{};
+        upgrade* upg = new (objects.alloc(sizeof(upgrade))) upgrade{};
         upg->x = x;
         upg->y = y;
         upg->dy = 30;
@@ -31,7 +31,7 @@ class ufo2 final : public game_object {
     }
 
     auto on_collision(game_object* obj) -> bool override {
-        ship2* shp = new (objects.alloc()) ship2{};
+        ship2* shp = new (objects.alloc(sizeof(ship2))) ship2{};
         shp->x = obj->x;
         shp->y = obj->y - sprite_height;
         shp->dx = random_float(-100, 100);
@@ -32,7 +32,8 @@ class upgrade final : public game_object {
     }
 
     auto on_death_by_collision() -> void override {
-        upgrade_picked* up = new (objects.alloc()) upgrade_picked{};
+        upgrade_picked* up =
+            new (objects.alloc(sizeof(upgrade_picked))) upgrade_picked{};
         up->x = x;
         up->y = y;
         up->dx = 50;
@@ -81,7 +81,7 @@ static auto create_fragments(float const orig_x, float const orig_y,
                              int32_t const count, float const speed,
                              clk::time const life_time_ms) -> void {
     for (int32_t i = 0; i < count; ++i) {
-        fragment* frg = new (objects.alloc()) fragment{};
+        fragment* frg = new (objects.alloc(sizeof(fragment))) fragment{};
         frg->die_at_ms = clk.ms + life_time_ms;
         frg->x = orig_x;
         frg->y = orig_y;
@@ -3,25 +3,83 @@ from PIL import Image
 import sys
 
 
-def print_sprites_as_game_resource(spr_width: int, spr_height: int, filename: str):
+def sprite_rows(img, spr_width: int, spr_height: int):
+    # yields rows of pixels of each sprite in order of sprite index
+    width, height = img.size
+    ix = 0
+    for row in range(0, height, spr_height):
+        for column in range(0, width, spr_width):
+            yield ix, [
+                [img.getpixel((x, y)) for x in range(column, column + spr_width)]
+                for y in range(row, row + spr_height)
+            ]
+            ix += 1
+
+
+def opaque_runs(pixels: list):
+    # returns list of (x, length) of consecutive non-zero pixels
+    runs = []
+    x = 0
+    while x < len(pixels):
+        if pixels[x] == 0:
+            x += 1
+            continue
+        start = x
+        while x < len(pixels) and pixels[x] != 0:
+            x += 1
+        runs.append((start, x - start))
+    return runs
+
+
+def print_sprites(sprites):
+    for ix, rows in sprites:
+        print("{ //", ix)
+        for pixels in rows:
+            for pixel in pixels:
+                print(f"0x{pixel:02X},", end="")
+            print()
+        print("},")
+
+
+def print_runs(sprites):
+    # opaque runs of all rows of all sprites
+    for ix, rows in sprites:
+        print("//", ix)
+        for pixels in rows:
+            for x, n in opaque_runs(pixels):
+                print(f"{{{x},{n}}},", end="")
+            print()
+
+
+def print_run_rows(sprites):
+    # index of first run of each row of each sprite followed by total
+    # number of runs
+    total = 0
+    for ix, rows in sprites:
+        print("//", ix)
+        for pixels in rows:
+            print(f"{total},", end="")
+            total += len(opaque_runs(pixels))
+        print()
+    print(f"{total},")
+
+
+def print_sprites_as_game_resource(
+    spr_width: int, spr_height: int, filename: str, output: str
+):
     try:
         with Image.open(filename) as img:
             if img.mode != "P":
                 print("Error: The PNG is not paletted.")
                 return
 
-            width, height = img.size
-            ix = 0
-            for row in range(0, height, spr_height):
-                for column in range(0, width, spr_width):
-                    print("{ //", ix)
-                    ix += 1
-                    for y in range(row, row + spr_height):
-                        for x in range(column, column + spr_width):
-                            pixel = img.getpixel((x, y))
-                            print(f"0x{pixel:02X},", end="")
-                        print()
-                    print("},")
+            sprites = sprite_rows(img, spr_width, spr_height)
+            if output == "runs":
+                print_runs(sprites)
+            elif output == "run-rows":
+                print_run_rows(sprites)
+            else:
+                print_sprites(sprites)
 
     except Exception as e:
         print(f"Error: {e}")
@@ -29,6 +87,11 @@ def print_sprites_as_game_resource(spr_width: int, spr_height: int, filename: st
 
 if __name__ == "__main__":
     if len(sys.argv) < 4:
-        print("usage: read-sprites <width> <height> <filename>")
+        print("usage: read-sprites <width> <height> <filename> [runs|run-rows]")
         sys.exit(1)
-    print_sprites_as_game_resource(int(sys.argv[1]), int(sys.argv[2]), sys.argv[3])
+    print_sprites_as_game_resource(
+        int(sys.argv[1]),
+        int(sys.argv[2]),
+        sys.argv[3],
+        sys.argv[4] if len(sys.argv) > 4 else "",
+    )
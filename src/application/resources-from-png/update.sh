@@ -6,6 +6,8 @@ SIZE=${1:-16}
 
 ./read-palette.py sprites.png >../resources/palette_sprites.hpp
 ./read-sprites.py $SIZE $SIZE sprites.png >../resources/sprite_imgs.hpp
+./read-sprites.py $SIZE $SIZE sprites.png runs >../resources/sprite_img_runs.hpp
+./read-sprites.py $SIZE $SIZE sprites.png run-rows >../resources/sprite_img_run_rows.hpp
 
 ./read-palette.py tiles.png >../resources/palette_tiles.hpp
 ./read-sprites.py $SIZE $SIZE tiles.png >../resources/tile_imgs.hpp
@@ -0,0 +1,513 @@
+// 0
+0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,
+// 1
+16,16,16,16,17,18,19,20,21,22,23,24,25,26,26,26,
+// 2
+26,28,30,32,33,34,35,36,37,38,39,40,41,42,44,46,
+// 3
+48,48,49,50,51,52,53,54,55,56,57,58,59,60,61,61,
+// 4
+61,61,61,63,65,67,69,71,73,75,77,79,81,83,85,85,
+// 5
+85,85,85,86,87,88,89,90,91,92,93,94,95,96,97,97,
+// 6
+97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,
+// 7
+97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,
+// 8
+97,98,100,103,107,112,117,122,127,132,137,142,147,151,154,156,
+// 9
+157,158,160,163,167,172,177,182,187,192,197,202,207,211,214,216,
+// 10
+217,218,219,220,221,222,223,224,225,226,227,228,229,230,231,232,
+// 11
+233,234,235,236,237,238,239,240,241,242,243,244,245,246,247,248,
+// 12
+249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,
+// 13
+249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,
+// 14
+249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,
+// 15
+249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,249,
+// 16
+249,250,251,252,253,254,255,256,257,258,259,260,261,262,263,264,
+// 17
+265,265,265,265,265,265,265,265,265,265,265,265,265,265,265,265,
+// 18
+265,265,265,265,265,265,265,265,265,265,265,265,265,265,265,265,
+// 19
+265,265,265,265,265,265,265,265,265,265,265,265,265,265,265,265,
+// 20
+265,265,265,265,265,265,265,265,265,265,265,265,265,265,265,265,
+// 21
+265,265,265,265,265,265,265,265,265,265,265,265,265,265,265,265,
+// 22
+265,265,265,265,265,265,265,265,265,265,265,265,265,265,265,265,
+// 23
+265,265,265,265,265,265,265,265,265,265,265,265,265,265,265,265,
+// 24
+265,265,265,265,265,265,265,265,265,265,265,265,265,265,265,265,
+// 25
+265,265,265,265,265,265,265,265,265,265,265,265,265,265,265,265,
+// 26
+265,266,267,268,269,270,271,272,273,274,275,276,277,278,279,280,
+// 27
+281,282,283,284,285,286,287,288,289,290,291,292,293,294,295,296,
+// 28
+297,297,297,297,297,297,297,297,297,297,297,297,297,297,297,297,
+// 29
+297,297,297,297,297,297,297,297,297,297,297,297,297,297,297,297,
+// 30
+297,297,297,297,297,297,297,297,297,297,297,297,297,297,297,297,
+// 31
+297,297,297,297,297,297,297,297,297,297,297,297,297,297,297,297,
+// 32
+297,298,299,300,301,302,303,304,305,306,307,308,309,310,311,312,
+// 33
+313,314,315,316,317,318,319,320,321,322,323,324,326,327,329,331,
+// 34
+332,333,334,335,336,337,338,339,340,343,346,347,348,350,352,354,
+// 35
+355,356,357,358,359,360,361,362,363,364,365,366,367,369,371,373,
+// 36
+375,375,375,375,376,377,378,379,380,381,382,383,384,385,386,387,
+// 37
+388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,
+// 38
+388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,
+// 39
+388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,
+// 40
+388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,
+// 41
+388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,
+// 42
+388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,
+// 43
+388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,
+// 44
+388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,
+// 45
+388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,
+// 46
+388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,
+// 47
+388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,388,
+// 48
+388,389,390,391,392,393,394,395,396,397,398,400,402,404,406,408,
+// 49
+410,411,412,413,414,415,416,417,418,419,420,422,424,426,428,430,
+// 50
+431,432,433,434,435,436,437,438,439,440,441,443,445,447,449,451,
+// 51
+452,453,454,455,456,457,458,459,460,461,462,464,466,468,470,472,
+// 52
+473,473,473,473,473,473,473,473,473,473,473,473,473,473,473,473,
+// 53
+473,473,473,473,473,473,473,473,473,473,473,473,473,473,473,473,
+// 54
+473,473,473,473,473,473,473,473,473,473,473,473,473,473,473,473,
+// 55
+473,473,473,473,473,473,473,473,473,473,473,473,473,473,473,473,
+// 56
+473,473,473,473,473,473,473,473,473,473,473,473,473,473,473,473,
+// 57
+473,473,473,473,473,473,473,473,473,473,473,473,473,473,473,473,
+// 58
+473,473,473,473,473,473,473,473,473,473,473,473,473,473,473,473,
+// 59
+473,473,473,473,473,473,473,473,473,473,473,473,473,473,473,473,
+// 60
+473,473,473,473,473,473,473,473,473,473,473,473,473,473,473,473,
+// 61
+473,473,473,473,473,473,473,473,473,473,473,473,473,473,473,473,
+// 62
+473,473,473,473,473,473,473,473,473,473,473,473,473,473,473,473,
+// 63
+473,473,473,473,473,473,473,473,473,473,473,473,473,473,473,473,
+// 64
+473,473,473,474,475,476,477,478,479,480,481,482,483,484,486,488,
+// 65
+490,490,490,491,492,493,494,495,496,497,498,499,500,501,503,505,
+// 66
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 67
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 68
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 69
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 70
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 71
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 72
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 73
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 74
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 75
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 76
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 77
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 78
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 79
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 80
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 81
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 82
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 83
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 84
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 85
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 86
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 87
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 88
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 89
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 90
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 91
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 92
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 93
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 94
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 95
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 96
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 97
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 98
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 99
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 100
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 101
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 102
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 103
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 104
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 105
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 106
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 107
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 108
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 109
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 110
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 111
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 112
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 113
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 114
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 115
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 116
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 117
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 118
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 119
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 120
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 121
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 122
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 123
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 124
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 125
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 126
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 127
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 128
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 129
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 130
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 131
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 132
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 133
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 134
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 135
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 136
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 137
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 138
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 139
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 140
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 141
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 142
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 143
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 144
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 145
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 146
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 147
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 148
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 149
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 150
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 151
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 152
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 153
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 154
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 155
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 156
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 157
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 158
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 159
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 160
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 161
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 162
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 163
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 164
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 165
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 166
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 167
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 168
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 169
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 170
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 171
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 172
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 173
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 174
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 175
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 176
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 177
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 178
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 179
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 180
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 181
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 182
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 183
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 184
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 185
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 186
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 187
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 188
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 189
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 190
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 191
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 192
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 193
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 194
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 195
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 196
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 197
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 198
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 199
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 200
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 201
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 202
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 203
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 204
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 205
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 206
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 207
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 208
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 209
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 210
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 211
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 212
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 213
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 214
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 215
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 216
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 217
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 218
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 219
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 220
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 221
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 222
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 223
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 224
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 225
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 226
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 227
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 228
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 229
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 230
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 231
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 232
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 233
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 234
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 235
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 236
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 237
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 238
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 239
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 240
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 241
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 242
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 243
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 244
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 245
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 246
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 247
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 248
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 249
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 250
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 251
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 252
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 253
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 254
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+// 255
+506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,506,
+506,
@@ -0,0 +1,4352 @@
+// 0
+{1,14},
+{0,16},
+{0,16},
+{0,16},
+{0,16},
+{0,16},
+{0,16},
+{0,16},
+{0,16},
+{0,16},
+{0,16},
+{0,16},
+{0,16},
+{0,16},
+{0,16},
+{1,14},
+// 1
+
+
+
+{4,8},
+{3,10},
+{3,10},
+{3,10},
+{3,10},
+{3,10},
+{3,10},
+{3,10},
+{3,10},
+{4,8},
+
+
+
+// 2
+{0,2},{14,2},
+{0,4},{12,4},
+{1,5},{10,5},
+{1,14},
+{2,12},
+{2,12},
+{3,10},
+{3,10},
+{3,10},
+{3,10},
+{2,12},
+{2,12},
+{1,14},
+{1,5},{10,5},
+{0,4},{12,4},
+{0,2},{14,2},
+// 3
+
+{8,1},
+{7,2},
+{7,1},
+{7,2},
+{8,1},
+{7,2},
+{7,1},
+{7,2},
+{8,1},
+{7,2},
+{7,1},
+{7,2},
+{8,1},
+
+
+// 4
+
+
+{4,1},{11,1},
+{3,1},{12,1},
+{3,2},{11,2},
+{4,1},{11,1},
+{3,2},{11,2},
+{3,1},{12,1},
+{3,2},{11,2},
+{4,1},{11,1},
+{3,2},{11,2},
+{3,1},{12,1},
+{3,2},{11,2},
+{4,1},{11,1},
+
+
+// 5
+
+
+{2,12},
+{1,14},
+{0,16},
+{0,16},
+{0,16},
+{1,14},
+{2,12},
+{3,10},
+{5,6},
+{6,4},
+{7,2},
+{7,2},
+
+
+// 6
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 7
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 8
+{7,2},
+{6,1},{9,1},
+{5,1},{7,2},{10,1},
+{4,1},{6,1},{9,1},{11,1},
+{3,1},{5,1},{7,2},{10,1},{12,1},
+{2,1},{4,1},{6,4},{11,1},{13,1},
+{1,1},{3,1},{5,6},{12,1},{14,1},
+{0,1},{2,1},{4,8},{13,1},{15,1},
+{0,1},{2,1},{4,8},{13,1},{15,1},
+{1,1},{3,1},{5,6},{12,1},{14,1},
+{2,1},{4,1},{6,4},{11,1},{13,1},
+{3,1},{5,1},{7,2},{10,1},{12,1},
+{4,1},{6,1},{9,1},{11,1},
+{5,1},{7,2},{10,1},
+{6,1},{9,1},
+{7,2},
+// 9
+{2,12},
+{1,6},{9,6},
+{0,6},{7,2},{10,6},
+{0,5},{6,1},{9,1},{11,5},
+{0,4},{5,1},{7,2},{10,1},{12,4},
+{0,3},{4,1},{6,4},{11,1},{13,3},
+{0,2},{3,1},{5,6},{12,1},{14,2},
+{0,1},{2,1},{4,8},{13,1},{15,1},
+{0,1},{2,1},{4,8},{13,1},{15,1},
+{0,2},{3,1},{5,6},{12,1},{14,2},
+{0,3},{4,1},{6,4},{11,1},{13,3},
+{0,4},{5,1},{7,2},{10,1},{12,4},
+{0,5},{6,1},{9,1},{11,5},
+{0,6},{7,2},{10,6},
+{1,6},{9,6},
+{2,12},
+// 10
+{13,3},
+{10,6},
+{8,8},
+{7,9},
+{6,10},
+{5,11},
+{4,12},
+{3,13},
+{2,14},
+{2,14},
+{1,15},
+{1,15},
+{1,15},
+{0,16},
+{0,16},
+{0,16},
+// 11
+{0,3},
+{0,6},
+{0,8},
+{0,9},
+{0,10},
+{0,11},
+{0,12},
+{0,13},
+{0,14},
+{0,14},
+{0,15},
+{0,15},
+{0,15},
+{0,16},
+{0,16},
+{0,16},
+// 12
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 13
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 14
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 15
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 16
+{1,14},
+{0,16},
+{0,16},
+{0,16},
+{0,16},
+{0,16},
+{0,16},
+{0,16},
+{0,16},
+{0,16},
+{0,16},
+{0,16},
+{0,16},
+{0,16},
+{0,16},
+{1,14},
+// 17
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 18
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 19
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 20
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 21
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 22
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 23
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 24
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 25
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 26
+{0,16},
+{0,16},
+{0,16},
+{1,15},
+{1,15},
+{1,15},
+{2,14},
+{2,14},
+{3,13},
+{4,12},
+{5,11},
+{6,10},
+{7,9},
+{8,8},
+{10,6},
+{13,3},
+// 27
+{0,16},
+{0,16},
+{0,16},
+{0,15},
+{0,15},
+{0,15},
+{0,14},
+{0,14},
+{0,13},
+{0,12},
+{0,11},
+{0,10},
+{0,9},
+{0,8},
+{0,6},
+{0,3},
+// 28
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 29
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 30
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 31
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 32
+{6,3},
+{5,5},
+{5,5},
+{5,4},
+{7,2},
+{6,3},
+{6,3},
+{6,3},
+{6,3},
+{6,3},
+{6,3},
+{7,2},
+{7,2},
+{7,2},
+{7,3},
+{7,3},
+// 33
+{7,3},
+{6,5},
+{6,5},
+{6,4},
+{7,2},
+{6,3},
+{6,3},
+{5,5},
+{5,5},
+{5,5},
+{4,5},
+{4,1},{6,4},
+{6,4},
+{6,1},{9,1},
+{6,1},{9,3},
+{6,3},
+// 34
+{6,3},
+{5,5},
+{5,5},
+{5,4},
+{7,2},
+{6,3},
+{5,5},
+{4,7},
+{2,3},{6,3},{10,3},
+{3,1},{6,3},{11,1},
+{6,4},
+{6,5},
+{6,2},{9,2},
+{5,2},{10,2},
+{4,2},{10,3},
+{4,3},
+// 35
+{6,3},
+{5,5},
+{5,5},
+{5,4},
+{7,2},
+{6,3},
+{6,3},
+{6,3},
+{5,5},
+{4,6},
+{5,5},
+{6,4},
+{6,2},{9,2},
+{4,3},{9,2},
+{5,2},{9,2},
+{6,1},{9,3},
+// 36
+
+
+
+{8,2},
+{7,4},
+{6,6},
+{7,4},
+{6,4},
+{6,3},
+{6,3},
+{5,4},
+{5,4},
+{6,4},
+{7,3},
+{6,3},
+{7,3},
+// 37
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 38
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 39
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 40
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 41
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 42
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 43
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 44
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 45
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 46
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 47
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 48
+{6,6},
+{5,8},
+{4,10},
+{3,12},
+{2,13},
+{1,15},
+{1,15},
+{0,16},
+{0,16},
+{0,15},
+{2,4},{11,2},
+{4,2},{11,2},
+{4,2},{11,2},
+{4,3},{11,3},
+{4,3},{11,3},
+{4,3},{11,3},
+// 49
+{6,6},
+{5,8},
+{4,10},
+{3,12},
+{2,13},
+{1,15},
+{1,15},
+{0,16},
+{0,16},
+{0,15},
+{2,5},{11,2},
+{4,3},{11,3},
+{3,3},{12,3},
+{2,3},{12,3},
+{2,4},{13,2},
+{3,3},
+// 50
+{6,6},
+{5,8},
+{4,10},
+{3,12},
+{2,13},
+{1,15},
+{1,15},
+{0,16},
+{0,16},
+{0,15},
+{2,5},{10,3},
+{3,4},{11,2},
+{1,5},{11,2},
+{2,2},{11,3},
+{2,2},{12,2},
+{12,2},
+// 51
+{6,6},
+{5,8},
+{4,10},
+{3,12},
+{2,13},
+{1,15},
+{1,15},
+{0,16},
+{0,16},
+{0,15},
+{2,5},{10,3},
+{5,2},{10,2},
+{4,3},{10,2},
+{4,3},{9,3},
+{4,3},{9,2},
+{9,2},
+// 52
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 53
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 54
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 55
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 56
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 57
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 58
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 59
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 60
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 61
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 62
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 63
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 64
+
+
+{5,6},
+{3,10},
+{2,12},
+{1,14},
+{1,14},
+{1,14},
+{0,16},
+{0,16},
+{0,16},
+{1,14},
+{4,8},
+{3,2},{11,2},
+{2,2},{12,2},
+{1,2},{13,2},
+// 65
+
+
+{5,6},
+{3,10},
+{2,12},
+{1,14},
+{1,14},
+{1,14},
+{0,16},
+{0,16},
+{0,16},
+{1,14},
+{4,8},
+{4,2},{10,2},
+{5,2},{9,2},
+{6,4},
+// 66
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 67
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 68
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 69
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 70
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 71
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 72
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 73
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 74
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 75
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 76
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 77
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 78
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 79
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 80
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 81
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 82
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 83
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 84
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 85
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 86
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 87
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 88
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 89
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 90
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 91
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 92
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 93
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 94
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 95
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 96
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 97
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 98
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 99
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 100
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 101
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 102
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 103
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 104
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 105
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 106
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 107
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 108
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 109
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 110
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 111
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 112
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 113
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 114
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 115
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 116
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 117
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 118
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 119
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 120
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 121
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 122
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 123
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 124
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 125
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 126
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 127
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 128
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 129
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 130
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 131
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 132
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 133
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 134
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 135
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 136
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 137
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 138
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 139
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 140
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 141
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 142
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 143
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 144
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 145
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 146
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 147
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 148
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 149
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 150
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 151
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 152
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 153
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 154
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 155
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 156
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 157
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 158
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 159
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 160
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 161
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 162
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 163
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 164
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 165
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 166
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 167
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 168
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 169
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 170
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 171
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 172
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 173
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 174
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 175
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 176
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 177
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 178
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 179
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 180
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 181
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 182
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 183
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 184
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 185
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 186
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 187
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 188
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 189
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 190
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 191
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 192
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 193
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 194
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 195
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 196
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 197
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 198
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 199
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 200
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 201
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 202
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 203
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 204
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 205
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 206
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 207
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 208
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 209
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 210
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 211
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 212
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 213
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 214
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 215
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 216
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 217
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 218
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 219
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 220
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 221
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 222
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 223
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 224
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 225
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 226
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 227
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 228
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 229
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 230
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 231
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 232
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 233
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 234
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 235
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 236
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 237
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 238
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 239
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 240
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 241
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 242
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 243
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 244
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 245
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 246
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 247
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 248
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 249
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 250
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 251
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 252
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 253
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 254
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// 255
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
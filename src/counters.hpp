@@ -0,0 +1,115 @@
+#pragma once
+//
+// counters of operations in the hot paths of the renderer and engine used to
+// estimate the frame time on device from runs on the host
+//
+
+// note: enabled with build flag `-D BAM_OP_COUNTERS`
+// note: when not enabled the counting compiles to nothing
+
+#include <cstdint>
+#include <cstdio>
+
+#ifdef BAM_OP_COUNTERS
+static bool constexpr counters_enabled = true;
+#else
+static bool constexpr counters_enabled = false;
+#endif
+
+// counted operations
+// note: pixels copied from the tile row cache are counted as tile pixels
+//       without palette lookups
+enum counter : uint8_t {
+    counter_tile_pixels,
+    counter_sprite_pixels,
+    counter_overlay_pixels,
+    counter_palette_lookups,
+    counter_transparent_skips,
+    counter_collision_reads,
+    counter_collision_writes,
+    counter_sprites_rejected,
+    counter_dma_transfers,
+    counter_dma_bytes,
+    counter_updates,
+    counter_pre_renders,
+    counter_count
+};
+
+static char const* const counter_names[counter_count]{
+    "tile_pixels",      "sprite_pixels",     "overlay_pixels",
+    "palette_lookups",  "transparent_skips", "collision_reads",
+    "collision_writes", "sprites_rejected",  "dma_transfers",
+    "dma_bytes",        "updates",           "pre_renders"};
+
+// counters incremented by one core
+struct counter_set {
+    uint32_t n[counter_count]{};
+
+    auto add(counter const c, uint32_t const k = 1) -> void {
+        if (counters_enabled) {
+            n[c] += k;
+        }
+    }
+
+    auto add(counter_set const& other) -> void {
+        if (!counters_enabled) {
+            return;
+        }
+        for (int32_t i = 0; i < counter_count; ++i) {
+            n[i] += other.n[i];
+        }
+    }
+};
+
+// operations by the engine on the first core
+static counter_set counters_engine;
+// operations by the renderer in current frame added by 'render(...)'
+// note: when 'engine_pipelined' written by the second core
+static counter_set counters_render;
+// operations in previous frame
+static counter_set counters_frame;
+
+// sums since last 'counters_clear()'
+static uint64_t counters_total[counter_count];
+static uint32_t counters_frames;
+
+// called at end of frame when rendering is done
+static inline auto counters_frame_end() -> void {
+    if (!counters_enabled) {
+        return;
+    }
+    counters_frame = counters_engine;
+    counters_frame.add(counters_render);
+    counters_engine = counter_set{};
+    counters_render = counter_set{};
+    for (int32_t i = 0; i < counter_count; ++i) {
+        counters_total[i] += counters_frame.n[i];
+    }
+    ++counters_frames;
+}
+
+// returns average of counter 'c' per frame since last 'counters_clear()'
+static inline auto counters_avg(counter const c) -> uint32_t {
+    return counters_frames ? uint32_t(counters_total[c] / counters_frames) : 0;
+}
+
+static inline auto counters_clear() -> void {
+    for (uint64_t& n : counters_total) {
+        n = 0;
+    }
+    counters_frames = 0;
+}
+
+// prints average of counters per frame since previous dump and clears them
+static inline auto counters_dump() -> void {
+    if (!counters_enabled || !counters_frames) {
+        return;
+    }
+    printf("------------------- operations per frame -----------------\n");
+    printf("            frames: %u\n", counters_frames);
+    for (int32_t i = 0; i < counter_count; ++i) {
+        printf("%18s: %u\n", counter_names[i], counters_avg(counter(i)));
+    }
+    printf("----------------------------------------------------------\n");
+    counters_clear();
+}
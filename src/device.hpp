@@ -3,9 +3,11 @@
 // device interface used by 'main.cpp' and implemented in `src/devices`
 //
 
-// note: device implementations must define global constants:
-//       `static int32_t const display_width`
-//       `static int32_t const display_height`
+// note: the global 'device' in 'main.cpp' has the concrete type of the board
+//       making calls in the hot path static, the virtual interface is for
+//       code that uses a device selected at run time
+// note: dimensions of the display are constants `display_width` and
+//       `display_height` defined in `display.hpp` for the device of the build
 
 // reviewed: 2024-05-22
 // reviewed: 2025-11-27
@@ -45,6 +47,12 @@ class device {
     // active
     virtual auto dma_wait_for_completion() -> void = 0;
 
+    // wait for previous DMA transaction to complete and set the display area
+    // written by following 'dma_write_bytes'
+    // note: writes continue at top left of the area when the area is filled
+    virtual auto dma_set_write_address_window(int16_t x, int16_t y, uint16_t w,
+                                              uint16_t h) -> void = 0;
+
     // returns true is SPIFFS present and initiated
     virtual auto spiffs_available() const -> bool = 0;
 
@@ -7,22 +7,13 @@
 // reviewed: 2025-11-27
 
 #include "../application/defs.hpp"
+#include "../display.hpp"
 #include "abstract_device.hpp"
 
 #include <SPI.h>
 #include <TFT_eSPI.h>
 #include <XPT2046_Bitbang.h>
 
-// define display dimensions depending on orientation using device natural
-// orientation and requested orientation
-// note: `display_width` and `display_height` are necessary constants for the
-//       framework
-//       `display_orientation` defined in `game/defs.hpp`
-// note: default orientation for this display is portrait = 0
-int32_t const display_width = display_orientation == 0 ? TFT_WIDTH : TFT_HEIGHT;
-int32_t const display_height =
-    display_orientation == 0 ? TFT_HEIGHT : TFT_WIDTH;
-
 class ESP32_2432S028R final : public abstract_device {
     static int32_t constexpr touch_mosi = 32;
     static int32_t constexpr touch_miso = 39;
@@ -81,4 +72,11 @@ class ESP32_2432S028R final : public abstract_device {
     auto dma_wait_for_completion() -> void override {
         return display.dmaWait();
     }
+
+    auto dma_set_write_address_window(int16_t const x, int16_t const y,
+                                      uint16_t const w, uint16_t const h)
+        -> void override {
+        display.dmaWait();
+        display.setAddrWindow(x, y, w, h);
+    }
 };
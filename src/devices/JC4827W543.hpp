@@ -10,19 +10,12 @@
 // reviewed: 2025-11-27
 
 #include "../application/defs.hpp"
+#include "../display.hpp"
 #include "abstract_device.hpp"
 
 #include <SPI.h>
 #include <driver/spi_master.h>
 
-// define display dimensions depending on orientation using device natural
-// orientation and requested orientation
-// note: `display_width` and `display_height` are necessary constants for the
-//       framework
-//       `display_orientation` is defined in `game/defs.hpp`
-int32_t const display_width = display_orientation == 1 ? 480 : 272;
-int32_t const display_height = display_orientation == 1 ? 272 : 480;
-
 // abstract class for resistive and capacitive versions of the device
 class JC4827W543 : public abstract_device {
     // maximum for this device
@@ -221,6 +214,15 @@ class JC4827W543 : public abstract_device {
             device_handle_, &transaction_async_, portMAX_DELAY));
     }
 
+    auto dma_set_write_address_window(int16_t const x, int16_t const y,
+                                      uint16_t const w, uint16_t const h)
+        -> void override {
+        // note: polling transactions cannot be made while a queued transaction
+        //       is active
+        dma_wait_for_completion();
+        set_write_address_window(x, y, w, h);
+    }
+
   private:
     static auto pre_transaction_cb(spi_transaction_t* trans) -> void {
         JC4827W543* dev = static_cast<JC4827W543*>(trans->user);
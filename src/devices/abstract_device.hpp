@@ -3,9 +3,7 @@
 // abstraction of the device used by 'main.cpp' and implemented in `src/devices`
 //
 
-// note: device implementations must define global constants:
-//    `static int32_t constexpr display_width`
-//    `static int32_t constexpr display_height`
+// note: dimensions of the display are defined in `display.hpp`
 
 // reviewed: 2025-11-27
 
@@ -0,0 +1,25 @@
+#pragma once
+//
+// dimensions of the display of the device selected by the build
+//
+
+#include "application/defs.hpp"
+
+#include <cstdint>
+
+// display dimensions depending on orientation using the natural orientation
+// of the device and the requested 'display_orientation'
+// note: constants of the build so that loops over the display are resolved at
+//       compile time
+// note: default orientation of the displays is portrait = 0
+#if defined(DEVICE_JC4827W543R) || defined(DEVICE_JC4827W543C)
+static int32_t constexpr display_width = display_orientation == 1 ? 480 : 272;
+static int32_t constexpr display_height = display_orientation == 1 ? 272 : 480;
+#else
+// note: `TFT_WIDTH` and `TFT_HEIGHT` defined in `platformio.ini` for
+//       ESP32-2432S028R and by the build of the emulator
+static int32_t constexpr display_width =
+    display_orientation == 0 ? TFT_WIDTH : TFT_HEIGHT;
+static int32_t constexpr display_height =
+    display_orientation == 0 ? TFT_HEIGHT : TFT_WIDTH;
+#endif
@@ -9,15 +9,62 @@
 // reviewed: 2025-11-27
 
 #include "application/defs.hpp"
+#include "counters.hpp"
+#include "display.hpp"
+#include "memory.hpp"
+#include "o1pools.hpp"
 #include "o1store.hpp"
+#include "profiler.hpp"
+#include "trace.hpp"
 
 #include <cstdint>
 #include <cstring>
 #include <limits>
 
-// defined by the device
-extern int32_t const display_width;
-extern int32_t const display_height;
+// render a snapshot of the sprites on the second core while the objects are
+// updated where the detected collisions are handled one frame later
+// note: enabled with build flag `-D BAM_PIPELINED_UPDATE`
+#ifdef BAM_PIPELINED_UPDATE
+static bool constexpr engine_pipelined = true;
+#else
+static bool constexpr engine_pipelined = false;
+#endif
+
+// render a snapshot of the sprites while the objects are updated in slices
+// when the DMA is busy where the detected collisions are handled one frame
+// later
+// note: enabled with build flag `-D BAM_COOPERATIVE_UPDATE`
+#ifdef BAM_COOPERATIVE_UPDATE
+static bool constexpr engine_cooperative = true;
+#else
+static bool constexpr engine_cooperative = false;
+#endif
+
+static_assert(!(engine_pipelined && engine_cooperative),
+              "BAM_PIPELINED_UPDATE and BAM_COOPERATIVE_UPDATE are exclusive");
+
+// report the end of each stage of 'engine_loop()' to the device
+// note: enabled with build flag `-D BAM_STAGE_TIMING`
+#ifdef BAM_STAGE_TIMING
+static bool constexpr engine_stage_timing = true;
+#else
+static bool constexpr engine_stage_timing = false;
+#endif
+
+// stages of 'engine_loop()' in order
+// note: when 'engine_pipelined' or 'engine_cooperative' the update of objects
+//       is done during 'engine_stage_render'
+enum engine_stage : uint8_t {
+    engine_stage_pre_render,
+    engine_stage_render,
+    engine_stage_update,
+    engine_stage_apply_free,
+    engine_stage_application,
+    engine_stage_count
+};
+
+static char const* const engine_stage_names[engine_stage_count]{
+    "pre_render", "render", "update", "apply_free", "application"};
 
 // resources
 
@@ -95,6 +142,28 @@ static uint8_t constexpr sprite_imgs[sprite_img_count]
 #include "application/resources/sprite_imgs.hpp"
                                     };
 
+// run of opaque pixels in a row of a sprite image
+struct sprite_img_run {
+    uint8_t x;   // first pixel
+    uint8_t len; // number of pixels
+};
+
+// opaque runs of all rows of all sprite images
+static sprite_img_run constexpr sprite_img_runs[]{
+#include "application/resources/sprite_img_runs.hpp"
+};
+
+// index in 'sprite_img_runs' of first run of each row of 'sprite_imgs'
+// note: runs of row 'r' are from 'sprite_img_run_rows[r]' to
+//       'sprite_img_run_rows[r + 1]'
+static uint16_t constexpr sprite_img_run_rows[]{
+#include "application/resources/sprite_img_run_rows.hpp"
+};
+
+static_assert(sizeof(sprite_img_run_rows) / sizeof(sprite_img_run_rows[0]) ==
+                  sprite_img_count * sprite_height + 1,
+              "'sprite_img_run_rows' does not match 'sprite_imgs'");
+
 // pointer to sprite image
 using sprite_img = uint8_t const*;
 
@@ -166,9 +235,6 @@ class object;
 
 class sprite final {
   public:
-    sprite** alloc_ptr;
-    // note: no default value since it would overwrite the 'o1store' assigned
-    //       value at 'alloc()'
     object* obj{};
     sprite_img img{};
     int16_t scr_x{};
@@ -177,6 +243,11 @@ class sprite final {
     // note: lower 'layer' number is rendered first
     //       number of layers specified by 'sprite_layer_count'
     uint8_t flip{}; // bits: horiz: 0b01, vert: 0b10
+    sprite_ix alloc_ix;
+    // note: no default value since it would overwrite the 'o1store' assigned
+    //       value at 'alloc()'
+    // note: index instead of pointer to keep 'sprite' and the snapshot of
+    //       sprites read by the renderer small
 
     static uint8_t constexpr flip_none = 0;
     static uint8_t constexpr flip_horizontal = 1;
@@ -184,7 +255,12 @@ class sprite final {
     static uint8_t constexpr flip_both = 3;
 };
 
-using sprites_store = o1store<sprite, sprite_count, 1>;
+// note: stores are read by the renderer for every scanline and are placed in
+//       internal memory
+// note: index mode with 'sprite_ix' since 'sprite_count' is limited by the
+//       collision map
+using sprites_store = o1store<sprite, sprite_count, 1, 0,
+                              memory_policy<memory_internal>, sprite_ix>;
 
 static sprites_store sprites;
 
@@ -212,23 +288,51 @@ class object {
     virtual auto pre_render() -> void {}
 };
 
+// objects in pools of size classes defined in 'application/defs.hpp'
 using object_store =
-    o1store<object, object_count, 2, object_instance_max_size_B>;
+    o1pools<object, object_count, 2, memory_policy<memory_internal>>;
 
 class objects : public object_store {
+    object** update_it_{};
+    object const* const* update_end_{};
+
   public:
+    objects()
+        : object_store{object_pool_sizes_B, object_pool_counts,
+                       object_pools_count} {}
+
+    // number of objects updated by 'update_slice()'
+    static int32_t constexpr update_slice_len = 4;
+
     auto update() -> void {
-        object const* const* end = allocated_list_end();
-        // note: important to get the 'end' outside the loop because objects may
-        //       allocate new objects in the loop and that would change the
-        //       'end'
-        for (object** it = allocated_list(); it < end; ++it) {
-            object* obj = *it;
+        update_begin();
+        while (update_slice()) {
+        }
+    }
+
+    // prepares to update allocated objects using 'update_slice()'
+    auto update_begin() -> void {
+        update_it_ = allocated_list();
+        update_end_ = allocated_list_end();
+        // note: important to get the 'end' before updating because objects may
+        //       allocate new objects and that would change the 'end'
+    }
+
+    // updates next 'update_slice_len' objects
+    // returns false when all objects have been updated
+    // note: objects freed are not deallocated until 'apply_free()' so the
+    //       list is stable between slices
+    auto update_slice() -> bool {
+        for (int32_t i = 0; i < update_slice_len && update_it_ < update_end_;
+             ++i, ++update_it_) {
+            object* obj = *update_it_;
+            counters_engine.add(counter_updates);
             if (!obj->update()) {
                 obj->~object();
                 free(obj);
             }
         }
+        return update_it_ < update_end_;
     }
 
     auto pre_render() -> void {
@@ -238,6 +342,7 @@ class objects : public object_store {
         //       'end'
         for (object** it = allocated_list(); it < end; ++it) {
             object* obj = *it;
+            counters_engine.add(counter_pre_renders);
             obj->pre_render();
         }
     }
@@ -317,29 +422,108 @@ auto render(int32_t x, int32_t y) -> void;
 // throughput
 auto render_bench(int32_t x, int32_t y) -> void;
 
+// forward declaration of platform specific functions that start rendering on
+// the second core and wait for it to complete
+auto render_async(int32_t x, int32_t y) -> void;
+auto render_wait() -> void;
+
+// forward declaration of platform specific function that renders while doing
+// 'engine_dma_busy_slice()' when the DMA is busy
+auto render_cooperative(int32_t x, int32_t y) -> void;
+
 // forward declaration of user provided callback
 auto application_on_frame_completed() -> void;
 
+// forward declaration of platform specific function called at the end of
+// 'stage' when 'engine_stage_timing'
+auto device_engine_stage_done(engine_stage stage) -> void;
+
+static inline auto engine_stage_done(engine_stage const stage) -> void {
+    trace_mark(engine_stage_names[stage]);
+    if (engine_stage_timing) {
+        device_engine_stage_done(stage);
+    }
+}
+
+// called by the renderer while the DMA is busy when 'engine_cooperative'
+// returns false when there is no more work to do in this frame
+static auto engine_dma_busy_slice() -> bool { return objects.update_slice(); }
+
 // callback from 'main.cpp'
 // render and update the state of the engine
 static auto engine_loop() -> void {
+    profiler_frame_begin();
+    trace_scope const frame_trace{"frame"};
+    trace_mark_begin();
+
     // prepare objects for render
-    objects.pre_render();
+    {
+        profiler_scope const zone{profiler_zone_pre_render};
+        objects.pre_render();
+    }
+    engine_stage_done(engine_stage_pre_render);
+
+    if (engine_pipelined) {
+        // start rendering tiles, sprites and collision map on the second core
+        render_async(int32_t(tile_map_x), int32_t(tile_map_y));
 
-    // render tiles, sprites and collision map
-    render(int32_t(tile_map_x), int32_t(tile_map_y));
+        // call 'update()' on allocated objects while rendering
+        {
+            profiler_scope const zone{profiler_zone_update};
+            objects.update();
+        }
 
-    // call 'update()' on allocated objects
-    objects.update();
+        // wait for render and set 'col_with' on objects to be handled at next
+        // 'update()'
+        render_wait();
+        engine_stage_done(engine_stage_render);
+    } else if (engine_cooperative) {
+        // render while calling 'update()' on allocated objects in slices when
+        // the DMA is busy
+        objects.update_begin();
+        render_cooperative(int32_t(tile_map_x), int32_t(tile_map_y));
+
+        // update the objects not updated while rendering
+        {
+            profiler_scope const zone{profiler_zone_update};
+            while (objects.update_slice()) {
+            }
+        }
 
-    // deallocate the objects freed during 'objects.update()'
-    objects.apply_free();
+        // set 'col_with' on objects to be handled at next 'update()'
+        render_wait();
+        engine_stage_done(engine_stage_render);
+    } else {
+        // render tiles, sprites and collision map
+        render(int32_t(tile_map_x), int32_t(tile_map_y));
+        engine_stage_done(engine_stage_render);
+
+        // call 'update()' on allocated objects
+        profiler_scope const zone{profiler_zone_update};
+        objects.update();
+    }
+    engine_stage_done(engine_stage_update);
 
-    // deallocate the sprites freed during 'objects.update()'
-    sprites.apply_free();
+    {
+        profiler_scope const zone{profiler_zone_apply_free};
+
+        // deallocate the objects freed during 'objects.update()'
+        objects.apply_free();
+
+        // deallocate the sprites freed during 'objects.update()'
+        sprites.apply_free();
+    }
+    engine_stage_done(engine_stage_apply_free);
 
     // application logic hook
-    application_on_frame_completed();
+    {
+        profiler_scope const zone{profiler_zone_application};
+        application_on_frame_completed();
+    }
+    engine_stage_done(engine_stage_application);
+
+    counters_frame_end();
+    profiler_frame_end();
 }
 
 // used for static assert of object sizes and config
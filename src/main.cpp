@@ -37,6 +37,7 @@
 // reviewed: 2025-11-27
 
 #include <Arduino.h>
+#include <esp_timer.h>
 #include <hal/efuse_hal.h>
 
 // main entry file to user code
@@ -45,6 +46,9 @@
 #include "renderer.hpp"
 
 // device file specified in `platformio.ini`
+// note: 'device' has the concrete 'final' type of the board so that calls
+//       are resolved at compile time instead of through the virtual table of
+//       the 'device' interface
 #if DEVICE_ESP32_2432S028R
 #include "devices/ESP32_2432S028R.hpp"
 static ESP32_2432S028R device;
@@ -62,17 +66,63 @@ static JC4827W543C device;
     "None of known devices defined: DEVICE_JC4827W543R, DEVICE_JC4827W543C, DEVICE_ESP32_2432S028R"
 #endif
 
+// note: the tile row cache is placed in PSRAM and does not fit in internal
+//       memory next to the buffers of the renderer
+#if defined(BAM_TILE_ROW_CACHE) && DEVICE_ESP32_2432S028R
+#error "BAM_TILE_ROW_CACHE requires PSRAM that ESP32-2432S028R does not have"
+#endif
+
 // functions used in `renderer.hpp` to decouple from device implementation
-auto device_dma_write_bytes(uint8_t const* data, uint32_t len) -> void {
+inline auto device_dma_write_bytes(uint8_t const* data, uint32_t len) -> void {
     device.dma_write_bytes(data, len);
 }
-auto device_dma_is_busy() -> bool { return device.dma_is_busy(); };
+inline auto device_dma_is_busy() -> bool { return device.dma_is_busy(); };
+inline auto device_dma_set_write_address_window(int16_t x, int16_t y,
+                                                uint16_t w, uint16_t h)
+    -> void {
+    device.dma_set_write_address_window(x, y, w, h);
+}
 auto device_alloc_dma_buffer(uint32_t n) -> void* {
     return heap_caps_calloc(1, n, MALLOC_CAP_DMA);
 }
 auto device_alloc_internal_buffer(uint32_t n) -> void* {
     return heap_caps_calloc(1, n, MALLOC_CAP_INTERNAL);
 }
+auto device_alloc_external_buffer(uint32_t n) -> void* {
+    // note: PSRAM if available
+    return heap_caps_calloc_prefer(1, n, 2, MALLOC_CAP_SPIRAM,
+                                   MALLOC_CAP_INTERNAL);
+}
+
+// second core renders every other band when 'render_parallel' or the whole
+// frame when 'engine_pipelined'
+static TaskHandle_t render_worker_task;
+static SemaphoreHandle_t render_worker_done;
+
+static auto render_worker_task_loop(void* /*unused*/) -> void {
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        render_worker();
+        xSemaphoreGive(render_worker_done);
+    }
+}
+
+auto device_render_worker_begin() -> void {
+    xTaskNotifyGive(render_worker_task);
+}
+auto device_render_worker_end() -> void {
+    xSemaphoreTake(render_worker_done, portMAX_DELAY);
+}
+inline auto device_render_worker_spin() -> void {
+    // note: the cores are busy waiting for each other only briefly
+}
+auto device_micros() -> uint32_t { return micros(); }
+auto device_engine_stage_done(engine_stage /*unused*/) -> void {}
+auto device_cycles() -> uint32_t { return ESP.getCycleCount(); }
+auto device_cycles_per_us() -> uint32_t { return ESP.getCpuFreqMHz(); }
+auto device_trace_ns() -> uint64_t {
+    return uint64_t(esp_timer_get_time()) * 1000;
+}
 // --
 
 auto setup() -> void {
@@ -121,6 +171,22 @@ auto setup() -> void {
 
     renderer_init();
 
+    if (render_bench_spans_at_setup) {
+        render_bench_spans();
+    }
+
+    if (render_parallel || engine_pipelined) {
+        // note: 'loop()' runs on core 1
+        render_worker_done = xSemaphoreCreateBinary();
+        if (!render_worker_done ||
+            xTaskCreatePinnedToCore(render_worker_task_loop, "render_worker",
+                                    4096, nullptr, 1, &render_worker_task,
+                                    0) != pdPASS) {
+            printf("!!! could not create render worker\n");
+            exit(1);
+        }
+    }
+
     // initiate clock
     clk.init(millis(), clk_fps_update_ms, clk_locked_dt_ms);
     // note: not in 'engine_init()' due to dependency on 'millis()'
@@ -129,11 +195,7 @@ auto setup() -> void {
 
     application_init();
 
-    printf("------------------- on heap ------------------------------\n");
-    printf("   DMA buf 1 and 2: %u B\n", 2 * dma_buffers.buf_size_B);
-    printf("      sprites data: %d B\n", sprites.allocated_data_size_B());
-    printf("      objects data: %d B\n", objects.allocated_data_size_B());
-    printf("     collision map: %u B\n", collision_map_size_B);
+    memory_dump();
     printf("------------------- after setup --------------------------\n");
     printf("     free heap mem: %u B\n", ESP.getFreeHeap());
     printf("largest free block: %u B\n", ESP.getMaxAllocHeap());
@@ -145,9 +207,10 @@ auto setup() -> void {
 auto loop() -> void {
     if (clk.on_frame(clk::time(millis()))) {
         // note: not in 'engine_loop()' due to dependency on 'millis()'
-        printf("t=%06u  fps=%02d  dma=%03d  objs=%03d  sprs=%03d\n", clk.ms,
-               clk.fps, dma_busy * 100 / (dma_writes ? dma_writes : 1),
-               objects.allocated_list_len(), sprites.allocated_list_len());
+        printf("t=%06u  fps=%02d  dma=%03d  skip=%02d  objs=%03d  sprs=%03d\n",
+               clk.ms, clk.fps, dma_busy * 100 / (dma_writes ? dma_writes : 1),
+               dma_skips, objects.allocated_list_len(),
+               sprites.allocated_list_len());
     }
 
     if (device.display_is_touched()) {
@@ -157,5 +220,20 @@ auto loop() -> void {
         application_on_touch(touches, touch_count > 10 ? 10 : touch_count);
     }
 
+    if ((profiler_enabled || trace_enabled || counters_enabled) &&
+        Serial.available()) {
+        // note: profiler statistics dumped on demand by sending 'p', trace
+        //       written as json by sending 't' and operations per frame by
+        //       sending 'c'
+        int const cmd = Serial.read();
+        if (profiler_enabled && cmd == 'p') {
+            profiler_dump();
+        } else if (trace_enabled && cmd == 't') {
+            trace_write(stdout);
+        } else if (counters_enabled && cmd == 'c') {
+            counters_dump();
+        }
+    }
+
     engine_loop();
 }
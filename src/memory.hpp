@@ -0,0 +1,100 @@
+#pragma once
+//
+// allocation of the buffers of the engine in memory regions of the device
+// with a report of the usage of each region
+//
+
+// note: all buffers are allocated at boot by the stores and 'renderer_init()'
+//       and are never freed
+// note: on the emulator all regions are allocated from one arena
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+// forward declarations to used device functions
+// note: returns zeroed memory or nullptr if allocation failed
+auto device_alloc_dma_buffer(uint32_t n) -> void*;
+auto device_alloc_internal_buffer(uint32_t n) -> void*;
+auto device_alloc_external_buffer(uint32_t n) -> void*;
+
+// memory regions of the device
+// note: 'memory_external' is PSRAM if available otherwise internal memory
+enum memory_region : uint8_t {
+    memory_internal,
+    memory_dma,
+    memory_external,
+    memory_region_count
+};
+
+static char const* const memory_region_names[memory_region_count]{
+    "internal", "dma", "external"};
+
+// named buffer allocated by 'memory_alloc(...)'
+struct memory_allocation {
+    char const* name;
+    int32_t id; // -1 if none
+    memory_region region;
+    uint32_t size_B;
+};
+
+// maximum number of allocations recorded for the report
+static int32_t constexpr memory_allocations_max = 32;
+
+static memory_allocation memory_allocations[memory_allocations_max];
+static int32_t memory_allocations_count;
+static uint32_t memory_region_used_B[memory_region_count];
+
+// allocates 'n' zeroed bytes in 'region' for buffer 'name' with optional 'id'
+// note: aborts if allocation fails
+// note: consecutive allocations of the same buffer are reported as one
+static inline auto memory_alloc(memory_region const region, uint32_t const n,
+                                char const* name, int32_t const id = -1)
+    -> void* {
+    void* p = region == memory_dma        ? device_alloc_dma_buffer(n)
+              : region == memory_internal ? device_alloc_internal_buffer(n)
+                                          : device_alloc_external_buffer(n);
+    if (!p) {
+        printf("!!! could not allocate %s: %u B in %s memory\n", name, n,
+               memory_region_names[region]);
+        exit(1);
+    }
+    memory_region_used_B[region] += n;
+    memory_allocation* prv =
+        memory_allocations_count
+            ? &memory_allocations[memory_allocations_count - 1]
+            : nullptr;
+    if (prv && prv->name == name && prv->id == id && prv->region == region) {
+        prv->size_B += n;
+    } else if (memory_allocations_count < memory_allocations_max) {
+        memory_allocations[memory_allocations_count] = {name, id, region, n};
+        ++memory_allocations_count;
+    }
+    return p;
+}
+
+// allocation policy of 'o1store' and 'o1pools' placing the store in 'region'
+template <memory_region region> struct memory_policy {
+    static auto alloc(size_t const n_B, int32_t const store_id) -> void* {
+        return memory_alloc(region, uint32_t(n_B), "o1store", store_id);
+    }
+};
+
+// prints the allocated buffers and the usage of each region
+static inline auto memory_dump() -> void {
+    printf("------------------- memory -------------------------------\n");
+    for (int32_t i = 0; i < memory_allocations_count; ++i) {
+        memory_allocation const& a = memory_allocations[i];
+        char name[32];
+        if (a.id == -1) {
+            snprintf(name, sizeof(name), "%s", a.name);
+        } else {
+            snprintf(name, sizeof(name), "%s %d", a.name, a.id);
+        }
+        printf("%18s: %u B %s\n", name, a.size_B,
+               memory_region_names[a.region]);
+    }
+    for (int32_t i = 0; i < memory_region_count; ++i) {
+        printf("%18s: %u B\n", memory_region_names[i], memory_region_used_B[i]);
+    }
+}
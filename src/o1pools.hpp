@@ -0,0 +1,229 @@
+#pragma once
+//
+// implements a O(1) store of objects of different sizes in pools of size
+// classes where each pool has its own list of free instances
+//
+
+// template parameters:
+// * 'type' is object type. 'type' must contain public field 'type **alloc_ptr'
+// * 'size' is total number of preallocated objects in all pools
+// * 'store_id' is used for debugging
+// * 'alloc_policy' as in 'o1store'
+//
+// note: allocated instances of all pools are in one list in allocation order
+//       the same way as in 'o1store'
+// note: instance index is the index of the pool's first instance plus the
+//       index of the instance in the pool
+// note: no destructor since life-time is program life-time
+//
+
+#include "o1store.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+template <typename type, int32_t const size, int32_t const store_id = 0,
+          typename alloc_policy = o1store_calloc>
+class o1pools {
+  public:
+    // maximum number of pools
+    static int32_t constexpr pools_max = 4;
+
+  private:
+    struct pool {
+        char* bgn;
+        char* end;
+        int32_t instance_size_B;
+        int32_t first_ix;
+        type** free_ptr;
+        type** free_end;
+    };
+
+    pool pools_[pools_max]{};
+    int32_t pools_count_{};
+    int32_t data_size_B_{};
+    char* all_{};
+    type** free_bgn_{};
+    type** alloc_bgn_{};
+    type** alloc_ptr_{};
+    type** del_bgn_{};
+    type** del_ptr_{};
+    type** del_end_{};
+
+    // returns index of the pool that contains 'inst'
+    inline auto pool_ix(type const* inst) const -> int32_t {
+        char const* p = reinterpret_cast<char const*>(inst);
+        int32_t i = 0;
+        while (i < pools_count_ - 1 && p >= pools_[i].end) {
+            ++i;
+        }
+        return i;
+    }
+
+  public:
+    // 'sizes_B' are the instance sizes of the pools in ascending order and
+    // 'counts' the number of instances in each pool where the sum is 'size'
+    // note: instance sizes must be a multiple of the alignment of 'type'
+    o1pools(int32_t const sizes_B[], int32_t const counts[],
+            int32_t const count_pools) {
+        if (count_pools < 1 || count_pools > pools_max) {
+            printf("!!! o1pools %d: number of pools must be 1 to %d\n",
+                   store_id, pools_max);
+            exit(1);
+        }
+        int32_t count = 0;
+        for (int32_t i = 0; i < count_pools; ++i) {
+            if (sizes_B[i] < int32_t(sizeof(type)) ||
+                sizes_B[i] % int32_t(alignof(type)) ||
+                (i && sizes_B[i] <= sizes_B[i - 1])) {
+                printf("!!! o1pools %d: invalid instance size %d\n", store_id,
+                       sizes_B[i]);
+                exit(1);
+            }
+            count += counts[i];
+            data_size_B_ += counts[i] * sizes_B[i];
+        }
+        if (count != size) {
+            printf("!!! o1pools %d: pools have %d instances, expected %d\n",
+                   store_id, count, size);
+            exit(1);
+        }
+
+        all_ = static_cast<char*>(
+            alloc_policy::alloc(size_t(data_size_B_), store_id));
+        free_bgn_ = static_cast<type**>(
+            alloc_policy::alloc(size * sizeof(type*), store_id));
+        alloc_ptr_ = alloc_bgn_ = static_cast<type**>(
+            alloc_policy::alloc(size * sizeof(type*), store_id));
+        del_ptr_ = del_bgn_ = static_cast<type**>(
+            alloc_policy::alloc(size * sizeof(type*), store_id));
+
+        if (!all_ || !free_bgn_ || !alloc_bgn_ || !del_bgn_) {
+            printf("!!! o1pools %d: could not allocate arrays\n", store_id);
+            exit(1);
+        }
+
+        del_end_ = del_bgn_ + size;
+
+        // partition 'all' and 'free' lists in pools and write pointers to
+        // instances in the 'free' list of each pool
+        pools_count_ = count_pools;
+        char* all_it = all_;
+        type** free_it = free_bgn_;
+        for (int32_t i = 0; i < count_pools; ++i) {
+            pool& pl = pools_[i];
+            pl.bgn = all_it;
+            pl.instance_size_B = sizes_B[i];
+            pl.first_ix = int32_t(free_it - free_bgn_);
+            pl.free_ptr = free_it;
+            for (int32_t j = 0; j < counts[i]; ++j) {
+                *free_it = reinterpret_cast<type*>(all_it);
+                ++free_it;
+                all_it += pl.instance_size_B;
+            }
+            pl.end = all_it;
+            pl.free_end = free_it;
+        }
+    }
+
+    // allocates an instance of at least 'size_B' bytes from the smallest
+    // size class that fits and has a free instance
+    // returns nullptr if instance could not be allocated
+    auto alloc(size_t const size_B) -> type* {
+        for (int32_t i = 0; i < pools_count_; ++i) {
+            pool& pl = pools_[i];
+            if (size_t(pl.instance_size_B) < size_B ||
+                pl.free_ptr >= pl.free_end) {
+                continue;
+            }
+            type* inst = *pl.free_ptr;
+            ++pl.free_ptr;
+            *alloc_ptr_ = inst;
+            inst->alloc_ptr = alloc_ptr_;
+            // note: needs compiler flag -flifetime-dse=1 for inst->alloc_ptr to
+            //       be written when inlined
+            //       see: https://github.com/espressif/crosstool-NG/issues/55
+            ++alloc_ptr_;
+            return inst;
+        }
+        return nullptr;
+    }
+
+    // adds instance to list of instances to be freed with 'apply_free()'
+    auto free(type* inst) -> void {
+        if (del_ptr_ >= del_end_) {
+            printf("!!! o1pools %d: free overrun\n", store_id);
+            exit(1);
+        }
+        *del_ptr_ = inst;
+        ++del_ptr_;
+    }
+
+    // deallocates the instances that have been freed
+    auto apply_free() -> void {
+        for (type** it = del_bgn_; it < del_ptr_; ++it) {
+            type* inst_deleted = *it;
+            --alloc_ptr_;
+            type* inst_to_move = *alloc_ptr_;
+            inst_to_move->alloc_ptr = inst_deleted->alloc_ptr;
+            *(inst_deleted->alloc_ptr) = inst_to_move;
+            pool& pl = pools_[pool_ix(inst_deleted)];
+            --pl.free_ptr;
+            *pl.free_ptr = inst_deleted;
+        }
+        del_ptr_ = del_bgn_;
+    }
+
+    // returns list of allocated instances
+    inline auto allocated_list() const -> type** { return alloc_bgn_; }
+
+    // returns length of list of allocated instances
+    inline auto allocated_list_len() const -> int32_t {
+        return int32_t(alloc_ptr_ - alloc_bgn_);
+    }
+
+    // returns one past the end of allocated instances list
+    inline auto allocated_list_end() const -> type** { return alloc_ptr_; }
+
+    // returns list of instances freed since last 'apply_free()'
+    inline auto freed_list() const -> type** { return del_bgn_; }
+
+    // returns one past the end of freed instances list
+    inline auto freed_list_end() const -> type** { return del_ptr_; }
+
+    // returns the total number of preallocated instances
+    auto constexpr all_list_len() const -> int32_t { return size; }
+
+    // returns instance at index 'ix' of all pools
+    inline auto instance(int32_t const ix) const -> type* {
+        int32_t i = pools_count_ - 1;
+        while (ix < pools_[i].first_ix) {
+            --i;
+        }
+        pool const& pl = pools_[i];
+        return reinterpret_cast<type*>(
+            pl.bgn + pl.instance_size_B * (ix - pl.first_ix));
+    }
+
+    // returns index of instance in all pools
+    inline auto instance_ix(type const* inst) const -> int32_t {
+        pool const& pl = pools_[pool_ix(inst)];
+        return pl.first_ix +
+               int32_t((reinterpret_cast<char const*>(inst) - pl.bgn) /
+                       pl.instance_size_B);
+    }
+
+    // returns number of pools
+    inline auto pools_count() const -> int32_t { return pools_count_; }
+
+    // returns number of free instances in pool 'ix'
+    inline auto pool_free_count(int32_t const ix) const -> int32_t {
+        return int32_t(pools_[ix].free_end - pools_[ix].free_ptr);
+    }
+
+    // returns the size of allocated heap memory in bytes
+    inline auto allocated_data_size_B() const -> int32_t {
+        return data_size_B_ + int32_t(3 * size * sizeof(type*));
+    }
+};
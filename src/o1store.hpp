@@ -5,11 +5,23 @@
 
 // template parameters:
 // * 'type' is object type. 'type' must contain public field 'type **alloc_ptr'
+//   or 'slot_type alloc_ix' when 'slot_type' is an index
 // * 'size' is number of preallocated objects
 // * 'store_id' is used for debugging
 // * 'instance_size_B' is custom size of instance to fit largest object in an
 //   object hierarchy or 0 if 'type' sizeof is used
+// * 'alloc_policy' provides 'static auto alloc(size_t n_B, int32_t store_id)
+//   -> void*' returning zeroed memory or nullptr, default is 'calloc'
+// * 'slot_type' is element of the free, allocated and freed lists: 'type*'
+//   or an unsigned integer type, e.g. 'uint8_t', holding index of instance in
+//   'all' list
 //
+// note: index mode reduces the lists and the back reference in instances to
+//       1 or 2 bytes per element instead of the size of a pointer at the cost
+//       of converting index to instance at 'alloc()', 'free()' and
+//       'apply_free()'
+//       allocated and freed lists are then lists of indexes, see
+//       'instance(ix)'
 // note: no destructor since life-time is program life-time
 //
 
@@ -17,31 +29,91 @@
 // reviewed: 2024-05-22
 // reviewed: 2025-11-27
 
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
+#include <type_traits>
+
+// default allocation policy of 'o1store' and 'o1pools'
+struct o1store_calloc {
+    static auto alloc(size_t const n_B, int32_t const /*store_id*/) -> void* {
+        return calloc(1, n_B);
+    }
+};
 
 template <typename type, int32_t const size, int32_t const store_id = 0,
-          int32_t const instance_size_B = 0>
+          int32_t const instance_size_B = 0,
+          typename alloc_policy = o1store_calloc, typename slot_type = type*>
 class o1store {
+    using index_mode =
+        std::integral_constant<bool, !std::is_pointer<slot_type>::value>;
+
+    static_assert(std::is_same<slot_type, type*>::value ||
+                      std::is_unsigned<slot_type>::value,
+                  "'slot_type' must be 'type*' or unsigned integer");
+    static_assert(sizeof(slot_type) >= sizeof(int32_t) ||
+                      ((size - 1) >> (8 * sizeof(slot_type))) == 0,
+                  "'size' does not fit in 'slot_type'");
+
     type* all_{};
-    type** free_bgn_{};
-    type** free_ptr_{};
-    type** free_end_{};
-    type** alloc_bgn_{};
-    type** alloc_ptr_{};
-    type** del_bgn_{};
-    type** del_ptr_{};
-    type** del_end_{};
+    slot_type* free_bgn_{};
+    slot_type* free_ptr_{};
+    slot_type* free_end_{};
+    slot_type* alloc_bgn_{};
+    slot_type* alloc_ptr_{};
+    slot_type* del_bgn_{};
+    slot_type* del_ptr_{};
+    slot_type* del_end_{};
+
+    // conversions between instance and element of the lists
+    inline auto to_slot(type* inst, std::false_type) const -> slot_type {
+        return inst;
+    }
+
+    inline auto to_slot(type* inst, std::true_type) const -> slot_type {
+        return slot_type(instance_ix(inst));
+    }
+
+    inline auto to_instance(slot_type s, std::false_type) const -> type* {
+        return s;
+    }
+
+    inline auto to_instance(slot_type s, std::true_type) const -> type* {
+        return instance(int32_t(s));
+    }
+
+    // back reference from instance to its element in allocated list
+    inline auto set_alloc_ref(type* inst, slot_type* at, std::false_type)
+        -> void {
+        inst->alloc_ptr = at;
+    }
+
+    inline auto set_alloc_ref(type* inst, slot_type* at, std::true_type)
+        -> void {
+        inst->alloc_ix = slot_type(at - alloc_bgn_);
+    }
+
+    inline auto alloc_ref(type const* inst, std::false_type) const
+        -> slot_type* {
+        return inst->alloc_ptr;
+    }
+
+    inline auto alloc_ref(type const* inst, std::true_type) const
+        -> slot_type* {
+        return alloc_bgn_ + inst->alloc_ix;
+    }
 
   public:
     o1store() {
-        all_ = static_cast<type*>(
-            calloc(size, instance_size_B ? instance_size_B : sizeof(type)));
-        free_ptr_ = free_bgn_ =
-            static_cast<type**>(calloc(size, sizeof(type*)));
-        alloc_ptr_ = alloc_bgn_ =
-            static_cast<type**>(calloc(size, sizeof(type*)));
-        del_ptr_ = del_bgn_ = static_cast<type**>(calloc(size, sizeof(type*)));
+        all_ = static_cast<type*>(alloc_policy::alloc(
+            size * (instance_size_B ? instance_size_B : sizeof(type)),
+            store_id));
+        free_ptr_ = free_bgn_ = static_cast<slot_type*>(
+            alloc_policy::alloc(size * sizeof(slot_type), store_id));
+        alloc_ptr_ = alloc_bgn_ = static_cast<slot_type*>(
+            alloc_policy::alloc(size * sizeof(slot_type), store_id));
+        del_ptr_ = del_bgn_ = static_cast<slot_type*>(
+            alloc_policy::alloc(size * sizeof(slot_type), store_id));
 
         if (!all_ || !free_bgn_ || !alloc_bgn_ || !del_bgn_) {
             printf("!!! o1store %d: could not allocate arrays\n", store_id);
@@ -51,16 +123,9 @@ class o1store {
         free_end_ = free_bgn_ + size;
         del_end_ = del_bgn_ + size;
 
-        // write pointers to instances in the 'free' list
-        type* all_it = all_;
-        for (type** free_it = free_bgn_; free_it < free_end_; ++free_it) {
-            *free_it = all_it;
-            if (instance_size_B) {
-                all_it = reinterpret_cast<type*>(
-                    reinterpret_cast<char*>(all_it) + instance_size_B);
-            } else {
-                ++all_it;
-            }
+        // write pointers or indexes of instances in the 'free' list
+        for (int32_t i = 0; i < size; ++i) {
+            free_bgn_[i] = to_slot(instance(i), index_mode{});
         }
     }
 
@@ -70,12 +135,13 @@ class o1store {
         if (free_ptr_ >= free_end_) {
             return nullptr;
         }
-        type* inst = *free_ptr_;
+        slot_type const s = *free_ptr_;
         ++free_ptr_;
-        *alloc_ptr_ = inst;
-        inst->alloc_ptr = alloc_ptr_;
-        // note: needs compiler flag -flifetime-dse=1 for inst->alloc_ptr to be
-        //       written when inlined
+        type* inst = to_instance(s, index_mode{});
+        *alloc_ptr_ = s;
+        set_alloc_ref(inst, alloc_ptr_, index_mode{});
+        // note: needs compiler flag -flifetime-dse=1 for the back reference to
+        //       be written when inlined
         //       see: https://github.com/espressif/crosstool-NG/issues/55
         ++alloc_ptr_;
         return inst;
@@ -87,26 +153,33 @@ class o1store {
             printf("!!! o1store %d: free overrun\n", store_id);
             exit(1);
         }
-        *del_ptr_ = inst;
+        *del_ptr_ = to_slot(inst, index_mode{});
         ++del_ptr_;
     }
 
     // deallocates the instances that have been freed
+    // note: the slot of a freed instance is taken by the last allocated
+    //       instance which is the newest allocation if the frame allocated
+    //       instances, see `emu/bench-o1store.cpp`
     auto apply_free() -> void {
-        for (type** it = del_bgn_; it < del_ptr_; ++it) {
-            type* inst_deleted = *it;
+        for (slot_type* it = del_bgn_; it < del_ptr_; ++it) {
+            slot_type const s_deleted = *it;
+            slot_type* ref = alloc_ref(to_instance(s_deleted, index_mode{}),
+                                       index_mode{});
             --alloc_ptr_;
-            type* inst_to_move = *alloc_ptr_;
-            inst_to_move->alloc_ptr = inst_deleted->alloc_ptr;
-            *(inst_deleted->alloc_ptr) = inst_to_move;
+            slot_type const s_to_move = *alloc_ptr_;
+            set_alloc_ref(to_instance(s_to_move, index_mode{}), ref,
+                          index_mode{});
+            *ref = s_to_move;
             --free_ptr_;
-            *free_ptr_ = inst_deleted;
+            *free_ptr_ = s_deleted;
         }
         del_ptr_ = del_bgn_;
     }
 
     // returns list of allocated instances
-    inline auto allocated_list() const -> type** { return alloc_bgn_; }
+    // note: list of indexes in 'all' list in index mode
+    inline auto allocated_list() const -> slot_type* { return alloc_bgn_; }
 
     // returns length of list of allocated instances
     inline auto allocated_list_len() const -> int32_t {
@@ -114,7 +187,14 @@ class o1store {
     }
 
     // returns one past the end of allocated instances list
-    inline auto allocated_list_end() const -> type** { return alloc_ptr_; }
+    inline auto allocated_list_end() const -> slot_type* { return alloc_ptr_; }
+
+    // returns list of instances freed since last 'apply_free()'
+    // note: list of indexes in 'all' list in index mode
+    inline auto freed_list() const -> slot_type* { return del_bgn_; }
+
+    // returns one past the end of freed instances list
+    inline auto freed_list_end() const -> slot_type* { return del_ptr_; }
 
     // returns the list with all preallocated instances
     inline auto all_list() const -> type* { return all_; }
@@ -132,10 +212,21 @@ class o1store {
                                        instance_size_B * ix);
     }
 
+    // returns index of instance in 'all' list
+    inline auto instance_ix(type const* inst) const -> int32_t {
+        if (!instance_size_B) {
+            return int32_t(inst - all_);
+        }
+        return int32_t((reinterpret_cast<char const*>(inst) -
+                        reinterpret_cast<char const*>(all_)) /
+                       instance_size_B);
+    }
+
     // returns the size of allocated heap memory in bytes
+    // note: the back reference is included in the size of the instances
     auto constexpr allocated_data_size_B() const -> int32_t {
         return instance_size_B
-                   ? (size * instance_size_B + 3 * size * sizeof(type*))
-                   : (size * sizeof(type) + 3 * size * sizeof(type*));
+                   ? (size * instance_size_B + 3 * size * sizeof(slot_type))
+                   : (size * sizeof(type) + 3 * size * sizeof(slot_type));
     }
 };
@@ -0,0 +1,240 @@
+#pragma once
+//
+// implements a O(1) store of objects where several cores allocate and free
+// instances concurrently without locks
+//
+
+// template parameters:
+// * 'type', 'size', 'store_id', 'instance_size_B' and 'alloc_policy' as in
+//   'o1store'
+// * 'cores' is number of cores that allocate instances
+// * 'cache_len' is number of free instances cached by each core
+//
+// note: 'alloc(core)' takes an instance from the cache of 'core' which is
+//       refilled from the shared free list with one atomic operation when
+//       empty
+// note: 'free(inst)' may be called by any core and adds the instance to a
+//       shared queue with one atomic operation
+// note: 'apply_free()' merges the instances allocated by the cores into the
+//       allocated list and deallocates the freed instances
+//       it must be called when no other core uses the store, e.g. after
+//       'render_wait()'
+// note: the allocated list is not changed by 'alloc' and 'free' thus it can
+//       be iterated while other cores allocate and free
+// note: no destructor since life-time is program life-time
+//
+
+#include "o1store.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+template <typename type, int32_t const size, int32_t const store_id = 0,
+          int32_t const instance_size_B = 0,
+          typename alloc_policy = o1store_calloc, int32_t const cores = 2,
+          int32_t const cache_len = 16>
+class o1store_mt {
+    // instances owned by a core
+    struct core_lists {
+        // free instances
+        type** cache_bgn;
+        type** cache_ptr;
+        // instances allocated since previous 'apply_free()'
+        type** new_bgn;
+        type** new_ptr;
+    };
+
+    type* all_{};
+    // shared free list where instances are taken from the top concurrently
+    // and put back by 'apply_free()'
+    // note: is negative when cores tried to take more than available
+    type** free_bgn_{};
+    std::atomic<int32_t> free_len_{0};
+    core_lists cores_[size_t(cores)]{};
+    type** alloc_bgn_{};
+    type** alloc_ptr_{};
+    // shared queue of instances to be freed at 'apply_free()'
+    type** del_bgn_{};
+    std::atomic<int32_t> del_len_{0};
+
+    inline auto alloc_array(size_t const n) -> type** {
+        return static_cast<type**>(
+            alloc_policy::alloc(n * sizeof(type*), store_id));
+    }
+
+    // moves free instances from the shared free list to the cache of 'cl'
+    // note: called by the core owning 'cl'
+    auto refill(core_lists& cl) -> void {
+        int32_t const n = free_len_.fetch_sub(cache_len);
+        int32_t const k = n < cache_len ? (n > 0 ? n : 0) : cache_len;
+        for (int32_t i = 1; i <= k; ++i) {
+            *cl.cache_ptr = free_bgn_[n - i];
+            ++cl.cache_ptr;
+        }
+    }
+
+  public:
+    o1store_mt() {
+        all_ = static_cast<type*>(alloc_policy::alloc(
+            size * (instance_size_B ? instance_size_B : sizeof(type)),
+            store_id));
+        free_bgn_ = alloc_array(size);
+        alloc_ptr_ = alloc_bgn_ = alloc_array(size);
+        del_bgn_ = alloc_array(size);
+        bool ok = all_ && free_bgn_ && alloc_bgn_ && del_bgn_;
+        for (core_lists& cl : cores_) {
+            cl.cache_ptr = cl.cache_bgn = alloc_array(cache_len);
+            cl.new_ptr = cl.new_bgn = alloc_array(size);
+            ok = ok && cl.cache_bgn && cl.new_bgn;
+        }
+
+        if (!ok) {
+            printf("!!! o1store_mt %d: could not allocate arrays\n", store_id);
+            exit(1);
+        }
+
+        // write pointers to instances in the 'free' list with first instance
+        // at the top
+        for (int32_t i = 0; i < size; ++i) {
+            free_bgn_[i] = instance(size - 1 - i);
+        }
+        free_len_ = size;
+    }
+
+    // allocates an instance by 'core' that is in the allocated list after
+    // next 'apply_free()'
+    // returns nullptr if instance could not be allocated
+    // note: only one thread may allocate for each 'core'
+    auto alloc(int32_t const core) -> type* {
+        core_lists& cl = cores_[core];
+        if (cl.cache_ptr == cl.cache_bgn) {
+            refill(cl);
+            if (cl.cache_ptr == cl.cache_bgn) {
+                return nullptr;
+            }
+        }
+        --cl.cache_ptr;
+        type* inst = *cl.cache_ptr;
+        *cl.new_ptr = inst;
+        inst->alloc_ptr = cl.new_ptr;
+        // note: needs compiler flag -flifetime-dse=1 for inst->alloc_ptr to be
+        //       written when inlined
+        //       see: https://github.com/espressif/crosstool-NG/issues/55
+        ++cl.new_ptr;
+        return inst;
+    }
+
+    // adds instance to queue of instances to be freed with 'apply_free()'
+    // note: may be called by any core
+    auto free(type* inst) -> void {
+        int32_t const i = del_len_.fetch_add(1, std::memory_order_relaxed);
+        if (i >= size) {
+            printf("!!! o1store_mt %d: free overrun\n", store_id);
+            exit(1);
+        }
+        del_bgn_[i] = inst;
+    }
+
+    // deallocates the instances that have been freed, adds the instances
+    // allocated by the cores to the allocated list and refills the caches
+    // note: must be called when no other core uses the store
+    auto apply_free() -> void {
+        int32_t free_len = free_len_.load(std::memory_order_acquire);
+        if (free_len < 0) {
+            free_len = 0;
+        }
+        int32_t const del_len = del_len_.load(std::memory_order_acquire);
+        for (int32_t i = 0; i < del_len; ++i) {
+            type* inst_deleted = del_bgn_[i];
+            type** slot = inst_deleted->alloc_ptr;
+            // slot is taken by the last allocated instance of the core that
+            // allocated 'inst_deleted' since previous apply, otherwise of the
+            // last core that allocated, otherwise of the allocated list
+            type** last = nullptr;
+            for (core_lists& cl : cores_) {
+                if (slot >= cl.new_bgn && slot < cl.new_ptr) {
+                    last = --cl.new_ptr;
+                    break;
+                }
+            }
+            for (int32_t c = cores - 1; !last && c >= 0; --c) {
+                if (cores_[c].new_ptr > cores_[c].new_bgn) {
+                    last = --cores_[c].new_ptr;
+                }
+            }
+            if (!last) {
+                last = --alloc_ptr_;
+            }
+            type* inst_to_move = *last;
+            inst_to_move->alloc_ptr = slot;
+            *slot = inst_to_move;
+            free_bgn_[free_len] = inst_deleted;
+            ++free_len;
+        }
+        del_len_.store(0, std::memory_order_relaxed);
+
+        // add allocated instances in order of cores and refill the caches
+        for (core_lists& cl : cores_) {
+            for (type** it = cl.new_bgn; it < cl.new_ptr; ++it) {
+                type* inst = *it;
+                *alloc_ptr_ = inst;
+                inst->alloc_ptr = alloc_ptr_;
+                ++alloc_ptr_;
+            }
+            cl.new_ptr = cl.new_bgn;
+            while (free_len > 0 && cl.cache_ptr < cl.cache_bgn + cache_len) {
+                --free_len;
+                *cl.cache_ptr = free_bgn_[free_len];
+                ++cl.cache_ptr;
+            }
+        }
+        free_len_.store(free_len, std::memory_order_release);
+    }
+
+    // returns list of allocated instances
+    inline auto allocated_list() const -> type** { return alloc_bgn_; }
+
+    // returns length of list of allocated instances
+    inline auto allocated_list_len() const -> int32_t {
+        return int32_t(alloc_ptr_ - alloc_bgn_);
+    }
+
+    // returns one past the end of allocated instances list
+    inline auto allocated_list_end() const -> type** { return alloc_ptr_; }
+
+    // returns number of instances that can be allocated
+    // note: not exact while cores allocate
+    inline auto free_count() const -> int32_t {
+        int32_t n = free_len_.load(std::memory_order_relaxed);
+        n = n > 0 ? n : 0;
+        for (core_lists const& cl : cores_) {
+            n += int32_t(cl.cache_ptr - cl.cache_bgn);
+        }
+        return n;
+    }
+
+    // returns the length of 'all' list
+    auto constexpr all_list_len() const -> int32_t { return size; }
+
+    // returns instance at index 'ix' from 'all' list
+    inline auto instance(int32_t const ix) const -> type* {
+        if (!instance_size_B) {
+            return &all_[ix];
+        }
+        // note: if instance size is specified do pointer shenanigans
+        return reinterpret_cast<type*>(reinterpret_cast<char*>(all_) +
+                                       instance_size_B * ix);
+    }
+
+    // returns index of instance in 'all' list
+    inline auto instance_ix(type const* inst) const -> int32_t {
+        if (!instance_size_B) {
+            return int32_t(inst - all_);
+        }
+        return int32_t((reinterpret_cast<char const*>(inst) -
+                        reinterpret_cast<char const*>(all_)) /
+                       instance_size_B);
+    }
+};
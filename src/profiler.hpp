@@ -0,0 +1,176 @@
+#pragma once
+//
+// profiler of time spent per frame in zones of the engine and renderer
+//
+
+// note: enabled with build flag `-D BAM_PROFILER`
+// note: when not enabled the zones compile to nothing
+
+#include <cstdint>
+#include <cstdio>
+
+#ifdef BAM_PROFILER
+static bool constexpr profiler_enabled = true;
+#else
+static bool constexpr profiler_enabled = false;
+#endif
+
+// forward declarations to used device functions
+// returns free running cycle counter
+auto device_cycles() -> uint32_t;
+// returns number of cycles per microsecond
+auto device_cycles_per_us() -> uint32_t;
+
+// timed zones
+// note: 'dma_wait' is the time waiting for DMA transfers and buffers including
+//       bands rendered by the second core
+// note: when 'render_parallel' only the bands rendered by the first core are
+//       timed in 'tiles', 'sprites' and 'overlay'
+enum profiler_zone : uint8_t {
+    profiler_zone_pre_render,
+    profiler_zone_sprite_lists,
+    profiler_zone_tiles,
+    profiler_zone_sprites,
+    profiler_zone_overlay,
+    profiler_zone_dma_wait,
+    profiler_zone_update,
+    profiler_zone_apply_free,
+    profiler_zone_application,
+    profiler_zone_count
+};
+
+static char const* const profiler_zone_names[profiler_zone_count]{
+    "pre_render", "sprite_lists", "tiles",      "sprites",    "overlay",
+    "dma_wait",   "update",       "apply_free", "application"};
+
+// number of buckets in the frame time histogram where the last bucket
+// contains the frames that did not fit in previous buckets
+static int32_t constexpr profiler_histogram_buckets = 16;
+// width of a bucket in the frame time histogram
+static uint32_t constexpr profiler_histogram_bucket_us = 2000;
+
+// min, max and sum of cycles over the frames since last 'profiler_dump()'
+struct profiler_stats {
+    uint32_t min = UINT32_MAX;
+    uint32_t max = 0;
+    uint64_t sum = 0;
+
+    auto add(uint32_t const cycles) -> void {
+        if (cycles < min) {
+            min = cycles;
+        }
+        if (cycles > max) {
+            max = cycles;
+        }
+        sum += cycles;
+    }
+};
+
+// cycles of zones in current frame
+static uint32_t profiler_frame_cycles[profiler_zone_count];
+// cycle counter at 'profiler_frame_begin()'
+static uint32_t profiler_frame_begin_cycles;
+
+// statistics since last 'profiler_dump()'
+static profiler_stats profiler_zone_stats[profiler_zone_count];
+static profiler_stats profiler_frame_stats;
+static uint32_t profiler_frames;
+static uint32_t profiler_histogram[profiler_histogram_buckets];
+
+// adds the cycles from construction to destruction to 'zone' in current frame
+// note: 'record' false for zones entered by the second core
+class profiler_scope final {
+  public:
+    explicit profiler_scope(profiler_zone const zone, bool const record = true)
+        : zone_{zone}, record_{record} {
+        if (profiler_enabled && record_) {
+            t0_ = device_cycles();
+        }
+    }
+
+    ~profiler_scope() {
+        if (profiler_enabled && record_) {
+            profiler_frame_cycles[zone_] += device_cycles() - t0_;
+        }
+    }
+
+    profiler_scope(profiler_scope const&) = delete;
+    auto operator=(profiler_scope const&) -> profiler_scope& = delete;
+
+  private:
+    uint32_t t0_{};
+    profiler_zone zone_;
+    bool record_;
+};
+
+// called at start of frame
+static inline auto profiler_frame_begin() -> void {
+    if (!profiler_enabled) {
+        return;
+    }
+    for (uint32_t& cycles : profiler_frame_cycles) {
+        cycles = 0;
+    }
+    profiler_frame_begin_cycles = device_cycles();
+}
+
+// called at end of frame to add the frame to the statistics
+static inline auto profiler_frame_end() -> void {
+    if (!profiler_enabled) {
+        return;
+    }
+    uint32_t const frame_cycles = device_cycles() - profiler_frame_begin_cycles;
+    for (int32_t i = 0; i < profiler_zone_count; ++i) {
+        profiler_zone_stats[i].add(profiler_frame_cycles[i]);
+    }
+    profiler_frame_stats.add(frame_cycles);
+    uint32_t const bucket =
+        frame_cycles / device_cycles_per_us() / profiler_histogram_bucket_us;
+    ++profiler_histogram[bucket < profiler_histogram_buckets
+                             ? bucket
+                             : profiler_histogram_buckets - 1];
+    ++profiler_frames;
+}
+
+// prints the statistics since previous dump and clears them
+static inline auto profiler_dump() -> void {
+    if (!profiler_enabled || !profiler_frames) {
+        return;
+    }
+    uint32_t const cycles_per_us = device_cycles_per_us();
+    printf("------------------- profiler -----------------------------\n");
+    printf("            frames: %u\n", profiler_frames);
+    printf("%18s  %8s  %8s  %8s\n", "us", "min", "avg", "max");
+    for (int32_t i = 0; i <= profiler_zone_count; ++i) {
+        profiler_stats const& st = i < profiler_zone_count
+                                       ? profiler_zone_stats[i]
+                                       : profiler_frame_stats;
+        printf("%18s  %8u  %8u  %8u\n",
+               i < profiler_zone_count ? profiler_zone_names[i] : "frame",
+               st.min / cycles_per_us,
+               uint32_t(st.sum / profiler_frames / cycles_per_us),
+               st.max / cycles_per_us);
+    }
+    printf("------------------- frame time histogram -----------------\n");
+    for (int32_t i = 0; i < profiler_histogram_buckets; ++i) {
+        uint32_t const from_ms = uint32_t(i) * profiler_histogram_bucket_us /
+                                 1000;
+        if (i < profiler_histogram_buckets - 1) {
+            printf("      %3u - %3u ms: %u\n", from_ms,
+                   from_ms + profiler_histogram_bucket_us / 1000,
+                   profiler_histogram[i]);
+        } else {
+            printf("         >= %3u ms: %u\n", from_ms, profiler_histogram[i]);
+        }
+    }
+    printf("----------------------------------------------------------\n");
+
+    for (profiler_stats& st : profiler_zone_stats) {
+        st = profiler_stats{};
+    }
+    profiler_frame_stats = profiler_stats{};
+    for (uint32_t& n : profiler_histogram) {
+        n = 0;
+    }
+    profiler_frames = 0;
+}
@@ -7,19 +7,178 @@
 
 #include "engine.hpp"
 
+#include <atomic>
 #include <cstring>
+#include <type_traits>
 
 // statistics about ratio of busy DMA before sending new buffer (higher is
 // better meaning DMA is not finished before rendering)
 static int32_t dma_busy;
 static int32_t dma_writes;
+// number of bands not transferred because unchanged since previous frame
+static int32_t dma_skips;
 
-// pixel precision collision detection between on screen sprites
-// allocated in 'renderer_init()'
-static uint32_t const collision_map_size_B =
-    sizeof(sprite_ix) * display_width * display_height;
-static sprite_ix* collision_map;
-// note: initialized at 'render_init' due to technical constraints of SP32
+// render bands on two cores where the second core renders every other band
+// note: enabled with build flag `-D BAM_PARALLEL_RENDER`
+#ifdef BAM_PARALLEL_RENDER
+static bool constexpr render_parallel = true;
+#else
+static bool constexpr render_parallel = false;
+#endif
+
+static_assert(!(render_parallel && engine_pipelined),
+              "BAM_PARALLEL_RENDER and BAM_PIPELINED_UPDATE both use the "
+              "second core");
+
+// number of workers rendering bands
+static int32_t constexpr render_workers_count = render_parallel ? 2 : 1;
+
+// render from a snapshot since objects are updated while rendering
+static bool constexpr render_snapshot = engine_pipelined || engine_cooperative;
+
+// sprites being rendered
+// note: when 'render_snapshot' a copy of 'sprites' taken before rendering
+//       otherwise 'sprites' list
+// initiated in 'renderer_init()'
+static sprite* render_sprites;
+
+// state of an object at the snapshot by index in 'objects'
+// note: when 'render_snapshot' the renderer does not access the objects that
+//       are being updated
+struct render_object {
+    collision_bits col_bits;
+    collision_bits col_mask;
+    bool freed; // true if freed during update while rendering
+};
+
+// allocated in 'renderer_init()' when 'render_snapshot'
+static render_object* render_objects;
+
+// compose bands as 8-bit palette indices that are converted to RGB565 in one
+// pass before the DMA transfer
+// note: enabled with build flag `-D BAM_INDEXED_COMPOSITE`
+// note: all layers use 'palette_tiles' thus 'palette_sprites' and
+//       'palette_overlay' must be the same
+// note: when 'render_skip_unchanged_bands' the signature is of the indices
+//       thus changes to 'palette_tiles' require
+//       'dma_band_signatures_valid = false'
+#ifdef BAM_INDEXED_COMPOSITE
+static bool constexpr render_indexed = true;
+#else
+static bool constexpr render_indexed = false;
+#endif
+
+// pixel composed by the renderer
+using render_pixel =
+    std::conditional<render_indexed, uint8_t, uint16_t>::type;
+
+// returns pixel composed from palette index 'ix'
+static inline auto render_px(uint16_t const* palette, uint8_t const ix)
+    -> render_pixel {
+    return render_pixel(render_indexed ? ix : palette[ix]);
+}
+
+// render each scanline front to back: overlay, sprite layers from top to
+// bottom and then tiles where a coverage map records the pixels that are final
+// so that later layers only write the pixels that are not covered
+// note: enabled with build flag `-D BAM_FRONT_TO_BACK`
+// note: collisions are detected for all opaque sprite pixels including the
+//       covered ones thus same as rendering back to front
+#ifdef BAM_FRONT_TO_BACK
+static bool constexpr render_front_to_back = true;
+#else
+static bool constexpr render_front_to_back = false;
+#endif
+
+// value in coverage map of pixel covered by the overlay
+// note: pixels covered by sprites have value of sprite layer + 1
+static uint8_t constexpr render_coverage_overlay = UINT8_MAX;
+static_assert(sprite_layer_count < render_coverage_overlay,
+              "sprite layers must fit in coverage map");
+
+// size of the collision map of a worker
+static uint32_t constexpr collision_map_size_B =
+    sizeof(sprite_ix) * display_width;
+// note: sprites only collide with pixels written on the same scanline so the
+//       map is one scanline wide and cleared before rendering each scanline
+
+// state of a worker rendering bands
+struct render_context {
+    // pixel precision collision detection between on screen sprites
+    // allocated in 'renderer_init()'
+    sprite_ix* collision_map{};
+    // note: initialized at 'render_init' due to technical constraints of SP32
+
+    // collisions detected during the frame by index of object in 'objects'
+    // note: the collision in the highest band is applied to the object after
+    //       all bands have been rendered giving same result as rendering the
+    //       bands in sequence
+    object* col_with[object_count]{};
+    int16_t col_band[object_count]{}; // -1 if no collision
+
+    // operations in current frame added to 'counters_render' at end of frame
+    counter_set ops{};
+
+    // band composed as palette indices
+    // allocated in 'renderer_init()' when 'render_indexed'
+    render_pixel* band{};
+
+    // layer covering each pixel of the scanline or 0 if not covered
+    // allocated in 'renderer_init()' when 'render_front_to_back'
+    uint8_t* coverage{};
+};
+
+static render_context render_contexts[render_workers_count];
+
+// cache of tile map rows rendered to composed pixels so that rendering a
+// scanline of tiles is a copy
+// note: enabled with build flag `-D BAM_TILE_ROW_CACHE`
+// note: requires PSRAM on the boards since the rows are about 190 KB at
+//       240 x 320, not available on ESP32-2432S028R
+#ifdef BAM_TILE_ROW_CACHE
+static bool constexpr render_tile_row_cache = true;
+#else
+static bool constexpr render_tile_row_cache = false;
+#endif
+
+// number of cached tile map rows in a ring covering the visible rows
+static int32_t constexpr render_tile_cache_rows =
+    display_height / tile_height + 2;
+
+// width of a cached scanline in pixels
+static int32_t constexpr render_tile_cache_width = tile_map_width * tile_width;
+
+// tile map row rendered in a cache row and its cells at the time of rendering
+// note: the cells are compared to the tile map to detect edits
+struct render_tile_cache_key {
+    int32_t tile_y; // -1 if not valid
+    tile_img_ix imgs[tile_map_width];
+    uint8_t flags[tile_map_width];
+};
+
+// rendered rows and keys
+// allocated in 'renderer_init()' when 'render_tile_row_cache'
+static render_pixel* render_tile_cache;
+static render_tile_cache_key* render_tile_cache_keys;
+
+// invalidates all rows in the tile row cache
+// note: edits of 'tile_map' and 'tile_map_flags' are detected but changes to
+//       'palette_tiles' or 'tile_imgs' require a call to this function
+inline auto render_tile_cache_invalidate() -> void {
+    for (int32_t i = 0; i < render_tile_cache_rows; ++i) {
+        render_tile_cache_keys[i].tile_y = -1;
+    }
+}
+
+// tile map position of the frame being rendered
+static int32_t render_x;
+static int32_t render_y;
+
+#ifdef BAM_VERIFY_COLLISION_MAP
+// full screen collision map used as reference to verify that the scanline
+// collision map produces the same collisions
+static sprite_ix* collision_map_verify;
+#endif
 
 // "Due to a technical limitation, the maximum statically allocated DRAM usage
 // is 160KB. The remaining 160KB (for a total of 320KB of DRAM) can only be
@@ -29,10 +188,18 @@ static sprite_ix* collision_map;
 // note: esp32 s3 can allocate more than 160 KB
 
 // forward declarations to used device functions
-auto device_dma_write_bytes(uint8_t const* data, uint32_t len) -> void;
-auto device_dma_is_busy() -> bool;
-auto device_alloc_dma_buffer(uint32_t n) -> void*;
-auto device_alloc_internal_buffer(uint32_t n) -> void*;
+// note: functions called for each band are inline and defined in the same
+//       translation unit as the global 'device' of the concrete type of the
+//       board so that the calls are bound at compile time and inlined
+inline auto device_dma_write_bytes(uint8_t const* data, uint32_t len) -> void;
+inline auto device_dma_is_busy() -> bool;
+inline auto device_dma_set_write_address_window(int16_t x, int16_t y,
+                                                uint16_t w, uint16_t h)
+    -> void;
+auto device_render_worker_begin() -> void;
+auto device_render_worker_end() -> void;
+inline auto device_render_worker_spin() -> void;
+auto device_micros() -> uint32_t;
 
 // number of scanlines to render before DMA transfer
 static int32_t constexpr dma_n_scanlines = 8;
@@ -42,111 +209,433 @@ static int32_t constexpr dma_n_scanlines = 8;
 //  JC4827W543R:
 //    1:27, 2:35, 4:41, 8:44, 16:47, 32:48, 64:hw limit exceeded
 
-// implements buffer swapping
+// skip DMA transfer of bands that are identical to previous frame
+// note: enabled with build flag `-D BAM_SKIP_UNCHANGED_BANDS`
+// note: a band is identified as unchanged by a signature of the rendered pixels
+#ifdef BAM_SKIP_UNCHANGED_BANDS
+static bool constexpr render_skip_unchanged_bands = true;
+#else
+static bool constexpr render_skip_unchanged_bands = false;
+#endif
+
+// render only the opaque runs of sprite image rows from 'sprite_img_runs'
+// skipping transparent pixels without testing them
+// note: enabled with build flag `-D BAM_SPRITE_OPAQUE_RUNS`
+// note: sprite images must be in 'sprite_imgs'
+#ifdef BAM_SPRITE_OPAQUE_RUNS
+static bool constexpr render_sprite_opaque_runs = true;
+#else
+static bool constexpr render_sprite_opaque_runs = false;
+#endif
+
+// benchmark span kernels in setup with 'render_bench_spans()'
+// note: enabled with build flag `-D BAM_BENCH_SPANS`
+#ifdef BAM_BENCH_SPANS
+static bool constexpr render_bench_spans_at_setup = true;
+#else
+static bool constexpr render_bench_spans_at_setup = false;
+#endif
+
+// number of DMA transfers (bands) to write a screen
+static int32_t constexpr dma_bands_count =
+    (display_height + dma_n_scanlines - 1) / dma_n_scanlines;
+
+// scanlines in the last band which has fewer scanlines if 'display_height' is
+// not evenly divisible by 'dma_n_scanlines'
+static int32_t constexpr dma_last_band_scanlines =
+    display_height - (dma_bands_count - 1) * dma_n_scanlines;
+
+// returns number of scanlines in 'band'
+// note: resolves to 'dma_n_scanlines' at compile time when the display is
+//       evenly divided in bands
+static inline auto constexpr dma_band_scanlines(int32_t const band)
+    -> int32_t {
+    return dma_last_band_scanlines == dma_n_scanlines ||
+                   band != dma_bands_count - 1
+               ? dma_n_scanlines
+               : dma_last_band_scanlines;
+}
+
+// count the writes of each pixel and time the rendering of each band for
+// visualization by the emulator
+// note: enabled with build flag `-D BAM_OVERDRAW_MAP`
+#ifdef BAM_OVERDRAW_MAP
+static bool constexpr render_overdraw = true;
+#else
+static bool constexpr render_overdraw = false;
+#endif
+
+// number of writes of each pixel of the display in the frame by tiles, sprites
+// and overlay saturating at 255
+// allocated in 'renderer_init()' when 'render_overdraw'
+static uint8_t* render_overdraw_map;
+
+// cycles of rendering each band in the frame
+// allocated in 'renderer_init()' when 'render_overdraw'
+static uint32_t* render_band_cycles;
+
+// adds a write of pixel at 'x', 'y' to 'render_overdraw_map'
+static inline auto render_overdraw_add(int32_t const x, int32_t const y)
+    -> void {
+    uint8_t& n = render_overdraw_map[y * display_width + x];
+    if (n != UINT8_MAX) {
+        ++n;
+    }
+}
+
+// signatures of bands sent at previous frame
+// allocated in 'renderer_init()' if 'render_skip_unchanged_bands'
+static uint32_t* dma_band_signatures;
+static bool dma_band_signatures_valid;
+
+// signatures of the bands composed as indices in current frame
+// allocated in 'renderer_init()' if 'render_skip_unchanged_bands' and
+// 'render_indexed'
+static uint32_t* dma_band_index_signatures;
+
+// display scanline that is written by next 'device_dma_write_bytes' and top
+// scanline of the current write address window
+static int32_t dma_write_y;
+static int32_t dma_write_window_y;
+
+// implements DMA buffers where each worker alternates between 2 buffers while
+// the DMA transfers a buffer
+// note: with one worker this is buffer swapping
 class dma_buffers final {
   public:
+    // number of buffers
+    static int32_t constexpr buf_count = 2 * render_workers_count;
+
     // size of a DMA buffer
-    uint32_t const buf_size_B =
+    static uint32_t constexpr buf_size_B =
         sizeof(uint16_t) * display_width * dma_n_scanlines;
 
     auto init() -> void {
-        buf_1_ = static_cast<uint16_t*>(device_alloc_dma_buffer(buf_size_B));
-        buf_2_ = static_cast<uint16_t*>(device_alloc_dma_buffer(buf_size_B));
-        if (!buf_1_ || !buf_2_) {
-            printf("!!! could not allocate DMA buffers\n");
-            exit(1);
+        for (int32_t i = 0; i < buf_count; ++i) {
+            bufs_[i] = static_cast<uint16_t*>(
+                memory_alloc(memory_dma, buf_size_B, "DMA buffers"));
         }
-        buf_current_ = buf_1_;
     }
 
-    auto current_buffer() -> uint16_t* { return buf_current_; }
+    auto buffer(int32_t const ix) const -> uint16_t* { return bufs_[ix]; }
 
-    auto swap() -> uint16_t* {
-        buf_current_ = buf_current_ == buf_1_ ? buf_2_ : buf_1_;
-        return buf_current_;
+    // returns index of a buffer owned by 'worker' that is not rendered or
+    // transferred
+    // note: spins until the buffer becomes available
+    auto acquire(int32_t const worker) -> int32_t {
+        while (true) {
+            for (int32_t i = 2 * worker; i < 2 * worker + 2; ++i) {
+                if (states_[i].load(std::memory_order_acquire) == state_free) {
+                    states_[i].store(state_rendering,
+                                     std::memory_order_relaxed);
+                    return i;
+                }
+            }
+            device_render_worker_spin();
+        }
     }
 
-  private:
-    uint16_t* buf_1_{};
-    uint16_t* buf_2_{};
-    uint16_t* buf_current_{};
-} static dma_buffers;
+    // called by worker when 'band' has been rendered to buffer 'ix'
+    auto set_rendered(int32_t const ix, int32_t const band) -> void {
+        bands_[ix] = band;
+        states_[ix].store(state_rendered, std::memory_order_release);
+    }
 
-inline auto renderer_init() -> void {
-    dma_buffers.init();
+    // returns index of buffer owned by 'worker' containing rendered 'band' or
+    // -1 if not rendered yet
+    auto rendered(int32_t const worker, int32_t const band) const -> int32_t {
+        for (int32_t i = 2 * worker; i < 2 * worker + 2; ++i) {
+            if (states_[i].load(std::memory_order_acquire) == state_rendered &&
+                bands_[i] == band) {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    // called when buffer 'ix' is handed to the DMA
+    // note: the DMA waits for the previous transfer to complete before making
+    //       a new so previously transferred buffer is available
+    auto set_transferring(int32_t const ix) -> void {
+        if (transferring_ != -1) {
+            states_[transferring_].store(state_free, std::memory_order_release);
+        }
+        transferring_ = ix;
+        states_[ix].store(state_transferring, std::memory_order_relaxed);
+    }
 
-    collision_map = static_cast<sprite_ix*>(device_alloc_internal_buffer(
-        display_width * display_height * sizeof(sprite_ix)));
-    if (!collision_map) {
-        printf("!!! could not allocate collision map\n");
-        exit(1);
+    // called when buffer 'ix' will not be transferred
+    auto release(int32_t const ix) -> void {
+        states_[ix].store(state_free, std::memory_order_release);
     }
+
+  private:
+    static int32_t constexpr state_free = 0;
+    static int32_t constexpr state_rendering = 1;
+    static int32_t constexpr state_rendered = 2;
+    static int32_t constexpr state_transferring = 3;
+
+    uint16_t* bufs_[buf_count]{};
+    std::atomic<int32_t> states_[buf_count]{};
+    int32_t bands_[buf_count]{};
+    int32_t transferring_ = -1;
+} static dma_buffers;
+
+// returns number of shifts to convert a 2^n number to 1
+static auto constexpr count_right_shifts_until_1(int32_t num) -> int32_t {
+    return (num <= 1) ? 0 : 1 + count_right_shifts_until_1(num >> 1);
 }
 
-// sprites to be rendered divided in layers
+// sprites to be rendered divided in layers and bins of scanlines
 struct render_sprite_entry {
     sprite const* spr{};
     sprite_ix ix{}; // index in sprite array
 };
 
-// list of sprites to render by layer
-static render_sprite_entry render_sprite_entries[sprite_layer_count]
-                                                [sprite_count];
-// pointers to end of list in 'render_sprite_entries'
-static render_sprite_entry* render_sprite_entries_end[sprite_layer_count];
+// visible sprites are placed in bins of 'sprite_height' scanlines so that a
+// scanline only iterates the sprites that may intersect it
+// note: a sprite intersects at most 2 bins
+static int32_t constexpr render_sprite_bin_shift =
+    count_right_shifts_until_1(sprite_height);
+
+// number of bins covering the display
+static int32_t constexpr render_sprite_bins_count =
+    (display_height + sprite_height - 1) >> render_sprite_bin_shift;
+
+// list of sprites to render ordered by layer, bin and sprite index
+static render_sprite_entry render_sprite_entries[2 * sprite_count];
+
+// index in 'render_sprite_entries' of the first entry of a layer and bin at
+// 'layer * render_sprite_bins_count + bin' with one past the last entry of
+// that bin at the next index
+// allocated in 'renderer_init()'
+static uint32_t constexpr render_sprite_bins_size_B =
+    sizeof(int16_t) *
+    uint32_t(sprite_layer_count * render_sprite_bins_count + 1);
+static int16_t* render_sprite_bins;
 
 static inline auto printf_render_sprite_entries_ram_usage() -> void {
-    printf("    render sprites: %zu B\n",
-           sizeof(render_sprite_entries) + sizeof(render_sprite_entries_end));
+    printf("    render sprites: %zu B\n", sizeof(render_sprite_entries));
+    printf("render sprite bins: %u B\n", render_sprite_bins_size_B);
+}
+
+// sets the first and last bin that a sprite intersects
+// returns false if sprite has no image or is outside the screen
+static inline auto render_sprite_bins_range(sprite const* spr,
+                                            int32_t& bin_first,
+                                            int32_t& bin_last) -> bool {
+    if (!spr->img || spr->scr_x <= -sprite_width ||
+        spr->scr_x >= display_width || spr->scr_y <= -sprite_height ||
+        spr->scr_y >= display_height) {
+        return false;
+    }
+    int32_t const first_y = spr->scr_y < 0 ? 0 : spr->scr_y;
+    int32_t const last_y = spr->scr_y + sprite_height > display_height
+                               ? display_height - 1
+                               : spr->scr_y + sprite_height - 1;
+    bin_first = first_y >> render_sprite_bin_shift;
+    bin_last = last_y >> render_sprite_bin_shift;
+    return true;
 }
 
-// build lists of visible sprites based on layer index
+// build lists of visible sprites based on layer index and scanline bins
 // only used in 'render(...)'
 static inline auto update_render_sprite_lists() -> void {
-    // set end of lists pointers to start of lists
-    for (int32_t i = 0; i < sprite_layer_count; ++i) {
-        render_sprite_entries_end[i] = &render_sprite_entries[i][0];
-    }
-    // build entries lists
-    sprite const* spr = sprites.all_list();
-    int32_t const len = sprites.all_list_len();
-    // note: "int32_t constexpr len" does not compile
+    int32_t const bins_len = sprite_layer_count * render_sprite_bins_count;
+    int32_t constexpr len = sprite_count;
+    int32_t bin_first = 0;
+    int32_t bin_last = 0;
+    // count entries in each bin
+    memset(render_sprite_bins, 0, render_sprite_bins_size_B);
+    sprite const* spr = render_sprites;
     for (int32_t i = 0; i < len; ++i, ++spr) {
-        if (!spr->img || spr->scr_x <= -sprite_width ||
-            spr->scr_x >= display_width || spr->scr_y <= -sprite_height ||
-            spr->scr_y >= display_height) {
-            // sprite has no image or is outside the screen
+        if (!render_sprite_bins_range(spr, bin_first, bin_last)) {
+            continue;
+        }
+        int16_t* layer_bins =
+            render_sprite_bins + spr->layer * render_sprite_bins_count;
+        for (int32_t b = bin_first; b <= bin_last; ++b) {
+            ++layer_bins[b];
+        }
+    }
+    // convert counts to index of one past the last entry in bin
+    for (int32_t i = 1; i < bins_len; ++i) {
+        render_sprite_bins[i] =
+            int16_t(render_sprite_bins[i] + render_sprite_bins[i - 1]);
+    }
+    render_sprite_bins[bins_len] = render_sprite_bins[bins_len - 1];
+    // place entries iterating sprites in reverse order while decrementing the
+    // bin index resulting in entries in ascending sprite index order and bin
+    // index at the first entry
+    spr = render_sprites + len - 1;
+    for (int32_t i = len - 1; i >= 0; --i, --spr) {
+        if (!render_sprite_bins_range(spr, bin_first, bin_last)) {
             continue;
         }
-        // create an entry at the end of the list of current sprite layer and
-        // increase that pointer
-        render_sprite_entry* rse = render_sprite_entries_end[spr->layer];
-        rse->ix = sprite_ix(i);
-        rse->spr = spr;
-        ++render_sprite_entries_end[spr->layer];
+        int16_t* layer_bins =
+            render_sprite_bins + spr->layer * render_sprite_bins_count;
+        for (int32_t b = bin_first; b <= bin_last; ++b) {
+            --layer_bins[b];
+            render_sprite_entry* rse = &render_sprite_entries[layer_bins[b]];
+            rse->ix = sprite_ix(i);
+            rse->spr = spr;
+        }
     }
 }
 
-// returns number of shifts to convert a 2^n number to 1
-static auto constexpr count_right_shifts_until_1(int32_t num) -> int32_t {
-    return (num <= 1) ? 0 : 1 + count_right_shifts_until_1(num >> 1);
+inline auto renderer_init() -> void {
+    dma_buffers.init();
+
+    for (render_context& ctx : render_contexts) {
+        ctx.collision_map = static_cast<sprite_ix*>(memory_alloc(
+            memory_internal, collision_map_size_B, "collision maps"));
+    }
+
+    if (render_skip_unchanged_bands) {
+        dma_band_signatures = static_cast<uint32_t*>(
+            memory_alloc(memory_internal,
+                         uint32_t(sizeof(uint32_t)) * uint32_t(dma_bands_count),
+                         "band signatures"));
+        if (render_indexed) {
+            dma_band_index_signatures = static_cast<uint32_t*>(memory_alloc(
+                memory_internal,
+                uint32_t(sizeof(uint32_t)) * uint32_t(dma_bands_count),
+                "band signatures"));
+        }
+    }
+
+    if (render_front_to_back) {
+        for (render_context& ctx : render_contexts) {
+            ctx.coverage = static_cast<uint8_t*>(memory_alloc(
+                memory_internal, uint32_t(display_width), "coverage maps"));
+        }
+    }
+
+    if (render_indexed) {
+        if (memcmp(palette_tiles, palette_sprites, sizeof(palette_tiles)) ||
+            memcmp(palette_tiles, palette_overlay, sizeof(palette_tiles))) {
+            printf("!!! indexed composite requires same palette for all "
+                   "layers\n");
+            exit(1);
+        }
+        for (render_context& ctx : render_contexts) {
+            ctx.band = static_cast<render_pixel*>(memory_alloc(
+                memory_internal,
+                uint32_t(sizeof(render_pixel)) * uint32_t(display_width) *
+                    dma_n_scanlines,
+                "indexed bands"));
+        }
+    }
+
+    render_sprite_bins = static_cast<int16_t*>(memory_alloc(
+        memory_internal, render_sprite_bins_size_B, "sprite bins"));
+
+    if (render_snapshot) {
+        render_sprites = static_cast<sprite*>(
+            memory_alloc(memory_internal,
+                         uint32_t(sizeof(sprite)) * uint32_t(sprite_count),
+                         "render sprites"));
+        render_objects = static_cast<render_object*>(memory_alloc(
+            memory_internal,
+            uint32_t(sizeof(render_object)) * uint32_t(object_count),
+            "render objects"));
+    } else {
+        render_sprites = sprites.all_list();
+    }
+
+    if (render_tile_row_cache) {
+        // note: rows are read once per scanline and fit in external memory
+        render_tile_cache = static_cast<render_pixel*>(memory_alloc(
+            memory_external,
+            uint32_t(sizeof(render_pixel)) * uint32_t(render_tile_cache_rows) *
+                tile_height * render_tile_cache_width,
+            "tile row cache"));
+        render_tile_cache_keys = static_cast<render_tile_cache_key*>(
+            memory_alloc(memory_internal,
+                         uint32_t(sizeof(render_tile_cache_key)) *
+                             uint32_t(render_tile_cache_rows),
+                         "tile cache keys"));
+        render_tile_cache_invalidate();
+    }
+
+    if (render_overdraw) {
+        render_overdraw_map = static_cast<uint8_t*>(
+            memory_alloc(memory_external,
+                         uint32_t(display_width) * uint32_t(display_height),
+                         "overdraw map"));
+        render_band_cycles = static_cast<uint32_t*>(
+            memory_alloc(memory_internal,
+                         uint32_t(sizeof(uint32_t)) * uint32_t(dma_bands_count),
+                         "band cycles"));
+    }
+
+#ifdef BAM_VERIFY_COLLISION_MAP
+    collision_map_verify = static_cast<sprite_ix*>(
+        memory_alloc(memory_external,
+                     uint32_t(display_width * display_height) *
+                         uint32_t(sizeof(sprite_ix)),
+                     "collision map verify"));
+#endif
+}
+
+// renders 'count' pixels from tile image row 'src' stepping 'inc' to 'dst'
+// note: when 'n' is not 0 then 'count' is 'n' and the loop is unrolled
+template <int32_t inc, int32_t n = 0>
+static inline auto render_tile_span(render_pixel* dst, uint8_t const* src,
+                                    uint16_t const* palette,
+                                    int32_t const count = n) -> void {
+#pragma GCC unroll 16
+    for (int32_t i = 0; i < (n ? n : count); ++i) {
+        dst[i] = render_px(palette, src[i * inc]);
+    }
+}
+
+// renders 'tile_width' pixels from tile image row 'src' stepping 'inc' to
+// 'dst' writing 2 pixels per 32-bit store when 'dst' is 4-byte aligned
+// note: pixel pairs are composed little-endian
+// note: when 'render_indexed' the row is copied if not flipped
+template <int32_t inc>
+static inline auto render_tile_span_full(render_pixel* dst, uint8_t const* src,
+                                         uint16_t const* palette) -> void {
+    static_assert(tile_width % 2 == 0, "tile_width must be even");
+    if (render_indexed && inc == 1) {
+        memcpy(dst, src, tile_width);
+        return;
+    }
+    if (render_indexed || reinterpret_cast<uintptr_t>(dst) & 3) {
+        render_tile_span<inc, tile_width>(dst, src, palette);
+        return;
+    }
+    render_pixel* dst_aligned =
+        static_cast<render_pixel*>(__builtin_assume_aligned(dst, 4));
+#pragma GCC unroll 16
+    for (int32_t i = 0; i < tile_width; i += 2) {
+        uint32_t const px = uint32_t(palette[src[i * inc]]) |
+                            uint32_t(palette[src[(i + 1) * inc]]) << 16;
+        memcpy(dst_aligned + i, &px, sizeof(px));
+        // note: 'memcpy' to aligned pointer compiles to a 32-bit store
+        //       without breaking strict aliasing
+    }
 }
 
 // renders a scanline of tiles
 // note: inline because it is only called from one location in render(...)
 template <bool enable_transparency = false>
 static inline auto render_scanline_tiles(
-    uint16_t* render_buf_ptr, uint16_t const* palette, uint8_t const* imgs,
+    render_pixel* render_buf_ptr, uint16_t const* palette, uint8_t const* imgs,
     int32_t tile_x, int32_t tile_x_fract, tile_img_ix const* tile_map_row_ptr,
     uint8_t const* tile_map_flags_row_ptr, int16_t const scanline_y,
     int32_t const tile_line_times_tile_width,
-    int32_t const tile_line_times_tile_width_flipped) -> void {
+    int32_t const tile_line_times_tile_width_flipped, counter_set& ops,
+    int32_t const width = display_width, uint8_t* coverage = nullptr) -> void {
 
     // pointer to first tile to render
     tile_img_ix const* tile_map_ptr = tile_map_row_ptr + tile_x;
     uint8_t const* tile_map_flags_ptr = tile_map_flags_row_ptr + tile_x;
+    // first pixel of scanline used when counting overdraw
+    render_pixel const* const scanline_ptr = render_buf_ptr;
     // for all horizontal pixels
-    int32_t remaining_x = display_width;
+    int32_t remaining_x = width;
     int32_t constexpr imgs_index_shift =
         count_right_shifts_until_1(tile_width * tile_height);
     while (remaining_x) {
@@ -165,7 +654,6 @@ static inline auto render_scanline_tiles(
         } else {
             tile_img_ptr += tile_x_fract;
         }
-        int32_t const tile_img_ptr_inc = flip_horiz ? -1 : 1;
         // calculate number of pixels to render
         int32_t render_n_pixels = 0;
         if (tile_x_fract) {
@@ -184,23 +672,61 @@ static inline auto render_scanline_tiles(
         remaining_x -= render_n_pixels;
         if (enable_transparency) {
             if (*tile_map_ptr != 0) {
+                int32_t const tile_img_ptr_inc = flip_horiz ? -1 : 1;
+                uint32_t written = 0;
+                uint32_t const n = uint32_t(render_n_pixels);
                 while (render_n_pixels--) {
                     uint8_t const px = *tile_img_ptr;
                     if (px != 0) {
-                        *render_buf_ptr = palette_tiles[px];
+                        *render_buf_ptr = render_px(palette_tiles, px);
+                        if (counters_enabled) {
+                            ++written;
+                        }
+                        if (render_overdraw) {
+                            render_overdraw_add(
+                                int32_t(render_buf_ptr - scanline_ptr),
+                                scanline_y);
+                        }
+                        if (render_front_to_back) {
+                            coverage[render_buf_ptr - scanline_ptr] =
+                                render_coverage_overlay;
+                        }
                     }
                     tile_img_ptr += tile_img_ptr_inc;
                     ++render_buf_ptr;
                 }
+                ops.add(counter_overlay_pixels, written);
+                if (!render_indexed) {
+                    ops.add(counter_palette_lookups, written);
+                }
+                ops.add(counter_transparent_skips, n - written);
             } else {
                 render_buf_ptr += render_n_pixels;
             }
         } else {
-            while (render_n_pixels--) {
-                *render_buf_ptr = palette[*tile_img_ptr];
-                tile_img_ptr += tile_img_ptr_inc;
-                ++render_buf_ptr;
+            ops.add(counter_tile_pixels, uint32_t(render_n_pixels));
+            if (!render_indexed) {
+                ops.add(counter_palette_lookups, uint32_t(render_n_pixels));
+            }
+            // dispatch to span specialized for flip and full tile width
+            if (render_n_pixels == tile_width) {
+                if (flip_horiz) {
+                    render_tile_span_full<-1>(render_buf_ptr, tile_img_ptr,
+                                              palette);
+                } else {
+                    render_tile_span_full<1>(render_buf_ptr, tile_img_ptr,
+                                             palette);
+                }
+            } else {
+                if (flip_horiz) {
+                    render_tile_span<-1>(render_buf_ptr, tile_img_ptr, palette,
+                                         render_n_pixels);
+                } else {
+                    render_tile_span<1>(render_buf_ptr, tile_img_ptr, palette,
+                                        render_n_pixels);
+                }
             }
+            render_buf_ptr += render_n_pixels;
         }
         // next tile
         ++tile_map_ptr;
@@ -208,25 +734,229 @@ static inline auto render_scanline_tiles(
     }
 }
 
+// returns cached scanline 'tile_line' of tile map row 'tile_y'
+// note: row must have been prepared by 'render_tile_cache_update()'
+static inline auto render_tile_cache_scanline(int32_t const tile_y,
+                                              int32_t const tile_line)
+    -> render_pixel* {
+    return render_tile_cache +
+           ((tile_y % render_tile_cache_rows) * tile_height + tile_line) *
+               render_tile_cache_width;
+}
+
+// renders the visible tile map rows that are not in the cache or have been
+// edited since cached
+// note: called before bands are rendered so that workers only read the cache
+static inline auto render_tile_cache_update() -> void {
+    int32_t const tile_y_first = render_y / tile_height;
+    int32_t const tile_y_last = (render_y + display_height - 1) / tile_height;
+    for (int32_t tile_y = tile_y_first; tile_y <= tile_y_last; ++tile_y) {
+        render_tile_cache_key& key =
+            render_tile_cache_keys[tile_y % render_tile_cache_rows];
+        if (key.tile_y == tile_y &&
+            !memcmp(key.imgs, &tile_map[tile_y][0], sizeof(key.imgs)) &&
+            !memcmp(key.flags, &tile_map_flags[tile_y][0], sizeof(key.flags))) {
+            continue;
+        }
+        key.tile_y = tile_y;
+        memcpy(key.imgs, &tile_map[tile_y][0], sizeof(key.imgs));
+        memcpy(key.flags, &tile_map_flags[tile_y][0], sizeof(key.flags));
+        for (int32_t tile_line = 0; tile_line < tile_height; ++tile_line) {
+            render_scanline_tiles(
+                render_tile_cache_scanline(tile_y, tile_line), palette_tiles,
+                &tile_imgs[0][0], 0, 0, &tile_map[tile_y][0],
+                &tile_map_flags[tile_y][0], 0, tile_line * tile_width,
+                (tile_height - 1 - tile_line) * tile_width, counters_render,
+                render_tile_cache_width);
+        }
+    }
+}
+
+// records in context that 'obj' collided with 'other_obj' in 'band' if 'obj'
+// declared interest in collisions with 'other_obj'
+static inline auto render_collision(render_context& ctx, object* obj,
+                                    object* other_obj, int16_t const band)
+    -> void {
+    int32_t const ix = objects.instance_ix(obj);
+    if (render_snapshot) {
+        if (!(render_objects[ix].col_mask &
+              render_objects[objects.instance_ix(other_obj)].col_bits)) {
+            return;
+        }
+    } else if (!(obj->col_mask & other_obj->col_bits)) {
+        return;
+    }
+    ctx.col_with[ix] = other_obj;
+    ctx.col_band[ix] = band;
+}
+
+// renders 'count' pixels of sprite row 'src' stepping 'inc' to 'dst' and
+// detects collisions with sprites in the same layer using collision map 'col'
+// note: when 'n' is not 0 then 'count' is 'n' and the loop is unrolled
+// note: when 'opaque' the pixels are not tested for transparency
+template <int32_t inc, int32_t n = 0, bool opaque = false>
+static inline auto
+render_sprite_span(render_pixel* dst, uint8_t const* src, sprite_ix* col,
+                   uint16_t const* palette, render_context& ctx,
+                   render_sprite_entry const* rse, int16_t const band,
+                   int16_t const scanline_y, int32_t const count = n) -> void {
+#ifdef BAM_VERIFY_COLLISION_MAP
+    sprite_ix* col_verify = collision_map_verify + scanline_y * display_width +
+                            (col - ctx.collision_map);
+#endif
+    // value in coverage map of pixels written by this layer
+    uint8_t const layer_mark =
+        render_front_to_back ? uint8_t(rse->spr->layer + 1) : 0;
+    uint32_t written = 0;
+    uint32_t opaque_n = 0;
+#pragma GCC unroll 16
+    for (int32_t i = 0; i < (n ? n : count); ++i) {
+        // write pixel from sprite data or skip if 0
+        uint8_t const color_ix = src[i * inc];
+        if (!opaque && !color_ix) {
+            continue;
+        }
+        if (counters_enabled) {
+            ++opaque_n;
+        }
+        sprite_ix* collision_pixel = col + i;
+        bool visible = true;
+        if (render_front_to_back) {
+            // pixel is final if covered by overlay or a higher layer
+            uint8_t& cov = ctx.coverage[collision_pixel - ctx.collision_map];
+            visible = !cov || cov == layer_mark;
+            cov = visible ? layer_mark : cov;
+        }
+        if (visible) {
+            if (counters_enabled) {
+                ++written;
+            }
+            dst[i] = render_px(palette, color_ix);
+            if (render_overdraw) {
+                render_overdraw_add(
+                    int32_t(collision_pixel - ctx.collision_map), scanline_y);
+            }
+        }
+#ifdef BAM_VERIFY_COLLISION_MAP
+        if (*collision_pixel != col_verify[i]) {
+            printf("!!! collision map differs at x=%d y=%d\n",
+                   int32_t(collision_pixel - ctx.collision_map),
+                   int32_t(scanline_y));
+            exit(1);
+        }
+        col_verify[i] = rse->ix;
+#endif
+        if (*collision_pixel != sprite_ix_reserved) {
+            // if other sprite has written to this pixel
+            sprite const* spr = rse->spr;
+            sprite const* other_spr = &render_sprites[*collision_pixel];
+            if (spr->layer == other_spr->layer) {
+                object* obj = spr->obj;
+                object* other_obj = other_spr->obj;
+                render_collision(ctx, obj, other_obj, band);
+                render_collision(ctx, other_obj, obj, band);
+            }
+        }
+        // set pixel collision value to sprite index
+        *collision_pixel = rse->ix;
+    }
+    ctx.ops.add(counter_sprite_pixels, written);
+    if (!render_indexed) {
+        ctx.ops.add(counter_palette_lookups, written);
+    }
+    ctx.ops.add(counter_collision_reads, opaque_n);
+    ctx.ops.add(counter_collision_writes, opaque_n);
+    ctx.ops.add(counter_transparent_skips,
+                uint32_t(n ? n : count) - opaque_n);
+}
+
+// renders the opaque runs of sprite image row 'img_row' to scanline
+// 'render_buf_ptr' and detects collisions using collision map 'col_row'
+// note: runs are rendered from left to right on screen so that collisions are
+//       recorded in the same order as when rendering pixel by pixel
+static inline auto render_sprite_runs(render_pixel* render_buf_ptr,
+                                      sprite_ix* col_row,
+                                      uint8_t const* img_row,
+                                      uint16_t const* palette,
+                                      render_context& ctx,
+                                      render_sprite_entry const* rse,
+                                      int16_t const band,
+                                      int16_t const scanline_y) -> void {
+    sprite const* spr = rse->spr;
+    bool const flip_horiz = spr->flip & sprite::flip_horizontal;
+    int32_t const row = int32_t(img_row - &sprite_imgs[0][0]) / sprite_width;
+    // visible pixels of sprite row
+    int32_t const clip_begin = spr->scr_x < 0 ? -spr->scr_x : 0;
+    int32_t const clip_end = spr->scr_x + sprite_width > display_width
+                                 ? display_width - spr->scr_x
+                                 : sprite_width;
+    int32_t const runs_begin = sprite_img_run_rows[row];
+    int32_t const runs_end = sprite_img_run_rows[row + 1];
+    for (int32_t i = runs_begin; i < runs_end; ++i) {
+        // when flipped the last run in image is the first on screen
+        sprite_img_run const& run =
+            sprite_img_runs[flip_horiz ? runs_end - 1 - (i - runs_begin) : i];
+        // run in sprite coordinates on screen
+        int32_t begin = flip_horiz ? sprite_width - run.x - run.len : run.x;
+        int32_t end = begin + run.len;
+        if (begin < clip_begin) {
+            begin = clip_begin;
+        }
+        if (end > clip_end) {
+            end = clip_end;
+        }
+        if (begin >= end) {
+            continue;
+        }
+        render_pixel* dst = render_buf_ptr + spr->scr_x + begin;
+        sprite_ix* col = col_row + spr->scr_x + begin;
+        if (flip_horiz) {
+            render_sprite_span<-1, 0, true>(
+                dst, img_row + sprite_width - 1 - begin, col, palette, ctx,
+                rse, band, scanline_y, end - begin);
+        } else {
+            render_sprite_span<1, 0, true>(dst, img_row + begin, col, palette,
+                                           ctx, rse, band, scanline_y,
+                                           end - begin);
+        }
+    }
+}
+
 // renders a scanline of sprites
 // note: inline because it is only called from one location in render(...)
-static inline auto render_scanline_sprites(uint16_t* render_buf_ptr,
+static inline auto render_scanline_sprites(render_pixel* render_buf_ptr,
                                            uint16_t const* palette,
-                                           sprite_ix* collision_map_row_ptr,
-                                           int32_t tile_x, int32_t tile_x_fract,
+                                           render_context& ctx,
+                                           int16_t const band,
                                            int16_t const scanline_y) -> void {
 
+    sprite_ix* collision_map_row_ptr = ctx.collision_map;
+
     // note: although grossly inefficient algorithm the DMA is mostly busy while
     //       rendering
 
-    for (int32_t layer = 0; layer < sprite_layer_count; ++layer) {
-        render_sprite_entry* spr_it_end = render_sprite_entries_end[layer];
-        for (render_sprite_entry* spr_it = &render_sprite_entries[layer][0];
+    // clear collision map for this scanline
+    // note: works on other sizes of type 'sprite_ix' because reserved value is
+    //       unsigned maximum value such as 0xff or 0xffff etc
+    memset(collision_map_row_ptr, sprite_ix_reserved, collision_map_size_B);
+
+    // bin of first layer that may intersect this scanline
+    int16_t const* bins =
+        render_sprite_bins + (scanline_y >> render_sprite_bin_shift);
+    for (int32_t i = 0; i < sprite_layer_count; ++i) {
+        // note: when 'render_front_to_back' top layer is rendered first
+        int32_t const layer =
+            render_front_to_back ? sprite_layer_count - 1 - i : i;
+        int16_t const* bin = bins + layer * render_sprite_bins_count;
+        render_sprite_entry const* spr_it_end =
+            &render_sprite_entries[*(bin + 1)];
+        for (render_sprite_entry const* spr_it = &render_sprite_entries[*bin];
              spr_it < spr_it_end; ++spr_it) {
             sprite const* const spr = spr_it->spr;
             if (spr->scr_y > scanline_y ||
                 spr->scr_y + sprite_height <= scanline_y) {
                 // not within scanline
+                ctx.ops.add(counter_sprites_rejected);
                 continue;
             }
             // pointer to sprite image to be rendered
@@ -240,14 +970,18 @@ static inline auto render_scanline_sprites(uint16_t* render_buf_ptr,
             } else {
                 spr_img_ptr += (scanline_y - spr->scr_y) * sprite_width;
             }
+            if (render_sprite_opaque_runs) {
+                render_sprite_runs(render_buf_ptr, collision_map_row_ptr,
+                                   spr_img_ptr, palette, ctx, spr_it, band,
+                                   scanline_y);
+                continue;
+            }
             if (flip_horiz) {
                 // start at end of sprite line
                 spr_img_ptr += sprite_width - 1;
             }
-            // increment to next sprite pixel to be rendered
-            int32_t const spr_img_ptr_inc = flip_horiz ? -1 : 1;
             // pointer to destination of sprite data
-            uint16_t* scanline_dst_ptr = render_buf_ptr + spr->scr_x;
+            render_pixel* scanline_dst_ptr = render_buf_ptr + spr->scr_x;
             // initial number of pixels to be rendered
             int32_t render_n_pixels = sprite_width;
             // pointer to collision map for first pixel of sprite
@@ -266,236 +1000,579 @@ static inline auto render_scanline_sprites(uint16_t* render_buf_ptr,
                 // adjustment if sprite partially outside screen (x-wise)
                 render_n_pixels = display_width - spr->scr_x;
             }
-            // render line from sprite to scanline and check collisions
-            object* obj = spr->obj;
-            while (render_n_pixels--) {
-                // write pixel from sprite data or skip if 0
-                uint8_t const color_ix = *spr_img_ptr;
-                if (color_ix) {
-                    // if not transparent pixel
-                    *scanline_dst_ptr = palette[color_ix];
-                    if (*collision_pixel != sprite_ix_reserved) {
-                        // if other sprite has written to this pixel
-                        sprite* other_spr = sprites.instance(*collision_pixel);
-                        if (spr->layer == other_spr->layer) {
-                            object* other_obj = other_spr->obj;
-                            if (obj->col_mask & other_obj->col_bits) {
-                                obj->col_with = other_obj;
-                            }
-                            if (other_obj->col_mask & obj->col_bits) {
-                                other_obj->col_with = obj;
-                            }
-                        }
-                    }
-                    // set pixel collision value to sprite index
-                    *collision_pixel = spr_it->ix;
+            // render line from sprite to scanline and check collisions using
+            // span specialized for flip and full sprite width
+            if (render_n_pixels == sprite_width) {
+                if (flip_horiz) {
+                    render_sprite_span<-1, sprite_width>(
+                        scanline_dst_ptr, spr_img_ptr, collision_pixel, palette,
+                        ctx, spr_it, band, scanline_y);
+                } else {
+                    render_sprite_span<1, sprite_width>(
+                        scanline_dst_ptr, spr_img_ptr, collision_pixel, palette,
+                        ctx, spr_it, band, scanline_y);
+                }
+            } else {
+                if (flip_horiz) {
+                    render_sprite_span<-1>(scanline_dst_ptr, spr_img_ptr,
+                                           collision_pixel, palette, ctx,
+                                           spr_it, band, scanline_y,
+                                           render_n_pixels);
+                } else {
+                    render_sprite_span<1>(scanline_dst_ptr, spr_img_ptr,
+                                          collision_pixel, palette, ctx, spr_it,
+                                          band, scanline_y, render_n_pixels);
                 }
-                spr_img_ptr += spr_img_ptr_inc;
-                ++collision_pixel;
-                ++scanline_dst_ptr;
             }
         }
     }
 }
 
-// renders tile map, sprites and overlay
-// ESP32-2432S028R: ~29 fps  dma: ~97%
-//     JC4827W543C: ~43 fps  dma: ~98%
-//     JC4827W543R: ~44 fps  dma: ~95%
-inline auto render(int32_t const x, int32_t const y) -> void {
-    // clear stats for this frame
-    dma_busy = dma_writes = 0;
+// returns signature of 'n_bytes' of rendered band used to detect unchanged
+// bands
+static inline auto dma_band_signature(void const* buf, int32_t const n_bytes)
+    -> uint32_t {
+    // note: FNV-1a on 32-bit words
+    uint32_t const* ptr = static_cast<uint32_t const*>(buf);
+    uint32_t const* const end = ptr + (n_bytes >> 2);
+    uint32_t hash = 2166136261u;
+    while (ptr < end) {
+        hash = (hash ^ *ptr) * 16777619u;
+        ++ptr;
+    }
+    return hash;
+}
 
-    // clear collisions map
-    // note: works on other sizes of type 'sprite_ix' because reserved value is
-    //       unsigned maximum value such as 0xff or 0xffff etc
-    memset(collision_map, sprite_ix_reserved, collision_map_size_B);
+// transfers DMA buffer 'buf_ix' containing 'band' to display
+// note: if band is unchanged since previous frame and
+//       'render_skip_unchanged_bands' then transfer is skipped
+static inline auto dma_write_band(int32_t const buf_ix, int32_t const band)
+    -> void {
+    uint16_t* buf = dma_buffers.buffer(buf_ix);
+    int32_t const y = band * dma_n_scanlines;
+    int32_t const n_scanlines = dma_band_scanlines(band);
+    if (render_skip_unchanged_bands) {
+        uint32_t const sig =
+            render_indexed
+                ? dma_band_index_signatures[band]
+                : dma_band_signature(buf, display_width * n_scanlines *
+                                              int32_t(sizeof(uint16_t)));
+        uint32_t& prv_sig = dma_band_signatures[band];
+        if (dma_band_signatures_valid && sig == prv_sig) {
+            ++dma_skips;
+            dma_buffers.release(buf_ix);
+            return;
+        }
+        prv_sig = sig;
+        if (y != dma_write_y) {
+            // previous band was skipped, set window from this band to bottom
+            // of screen
+            device_dma_set_write_address_window(
+                0, int16_t(y), uint16_t(display_width),
+                uint16_t(display_height - y));
+            dma_write_window_y = y;
+        }
+        dma_write_y = y + n_scanlines;
+        if (dma_write_y == display_height) {
+            // display continues writing at top of window
+            dma_write_y = dma_write_window_y;
+        }
+    }
+    ++dma_writes;
+    dma_busy += device_dma_is_busy() ? 1 : 0;
+    uint32_t const len =
+        uint32_t(display_width * n_scanlines * int32_t(sizeof(uint16_t)));
+    counters_render.add(counter_dma_transfers);
+    counters_render.add(counter_dma_bytes, len);
+    if (engine_cooperative) {
+        // do work while previous transfer completes
+        // note: recorded as update and not as waiting for DMA
+        profiler_scope const zone{profiler_zone_update};
+        trace_scope const slices_trace{"update slices"};
+        while (device_dma_is_busy() && engine_dma_busy_slice()) {
+        }
+    }
+    profiler_scope const zone{profiler_zone_dma_wait};
+    trace_scope const wait_trace{"dma wait"};
+    device_dma_write_bytes(reinterpret_cast<uint8_t*>(buf), len);
+    dma_buffers.set_transferring(buf_ix);
+}
+
+// renders overlay row 'overlay_y' line 'overlay_line' to scanline
+// 'render_buf_ptr' and when 'render_front_to_back' marks the written pixels
+// in the coverage map
+static inline auto render_scanline_overlay(render_context& ctx,
+                                           render_pixel* render_buf_ptr,
+                                           int32_t const scanline_y,
+                                           int32_t const overlay_y,
+                                           int32_t const overlay_line)
+    -> void {
+    render_scanline_tiles<true>(
+        render_buf_ptr, palette_overlay, &overlay_imgs[0][0], 0, 0,
+        &overlay_map[overlay_y][0], &overlay_map_flags[overlay_y][0],
+        int16_t(scanline_y), overlay_line * tile_width,
+        (tile_height - 1 - overlay_line) * tile_width, ctx.ops, display_width,
+        ctx.coverage);
+}
+
+// renders tile map row 'tile_y' line 'tile_line' to the pixels of scanline
+// 'render_buf_ptr' that are not covered in the coverage map
+// note: only used when 'render_front_to_back'
+static inline auto render_scanline_tile_gaps(render_context& ctx,
+                                             render_pixel* render_buf_ptr,
+                                             int32_t const scanline_y,
+                                             int32_t const tile_y,
+                                             int32_t const tile_line) -> void {
+    int32_t constexpr tile_width_shift = count_right_shifts_until_1(tile_width);
+    int32_t constexpr tile_width_and = (1 << tile_width_shift) - 1;
+    uint8_t const* cov = ctx.coverage;
+    int32_t x = 0;
+    while (x < display_width) {
+        if (cov[x]) {
+            ++x;
+            continue;
+        }
+        // span of pixels not covered
+        int32_t const begin = x;
+        while (x < display_width && !cov[x]) {
+            ++x;
+        }
+        int32_t const len = x - begin;
+        int32_t const map_x = render_x + begin;
+        if (render_tile_row_cache) {
+            memcpy(render_buf_ptr + begin,
+                   render_tile_cache_scanline(tile_y, tile_line) + map_x,
+                   sizeof(render_pixel) * size_t(len));
+            ctx.ops.add(counter_tile_pixels, uint32_t(len));
+        } else {
+            render_scanline_tiles(
+                render_buf_ptr + begin, palette_tiles, &tile_imgs[0][0],
+                map_x >> tile_width_shift, map_x & tile_width_and,
+                &tile_map[tile_y][0], &tile_map_flags[tile_y][0],
+                int16_t(scanline_y), tile_line * tile_width,
+                (tile_height - 1 - tile_line) * tile_width, ctx.ops, len);
+        }
+        if (render_overdraw) {
+            memset(render_overdraw_map + scanline_y * display_width + begin, 1,
+                   size_t(len));
+        }
+    }
+}
+
+// converts 'n' palette indices 'src' to RGB565 'dst' using 'palette_tiles'
+static inline auto render_convert_indexed(uint16_t* dst,
+                                          render_pixel const* src,
+                                          int32_t const n) -> void {
+#pragma GCC unroll 16
+    for (int32_t i = 0; i < n; ++i) {
+        dst[i] = palette_tiles[src[i]];
+    }
+}
 
+// returns buffer where 'ctx' composes the band written to DMA buffer 'dma_buf'
+static inline auto render_band_buffer(render_context& ctx, uint16_t* dma_buf)
+    -> render_pixel* {
+    return render_indexed ? ctx.band
+                          : static_cast<render_pixel*>(
+                                static_cast<void*>(dma_buf));
+}
+
+// renders tile map, sprites and overlay of 'band' to 'dma_buf'
+static inline auto render_band(render_context& ctx, uint16_t* dma_buf,
+                               int32_t const band) -> void {
     // extract whole number and fractions from x, y
     int32_t constexpr tile_width_shift = count_right_shifts_until_1(tile_width);
     int32_t constexpr tile_height_shift =
         count_right_shifts_until_1(tile_height);
     int32_t constexpr tile_width_and = (1 << tile_width_shift) - 1;
     int32_t constexpr tile_height_and = (1 << tile_height_shift) - 1;
-    int32_t const tile_x = x >> tile_width_shift;
-    int32_t const tile_x_fract = x & tile_width_and;
-    int32_t tile_y = y >> tile_height_shift;
-    int32_t tile_y_fract = y & tile_height_and;
-    // current scanline screen y
-    int16_t scanline_y = 0;
-    // pointer to start of current row of tiles
-    tile_img_ix const* tile_map_row_ptr = &tile_map[tile_y][0];
-    // pointer to start of current row of tile flags
-    uint8_t const* tile_map_flags_row_ptr = &tile_map_flags[tile_y][0];
-
-    // overlay
-    overlay_img_ix const* overlay_map_row_ptr = &overlay_map[0][0];
-    uint8_t const* overlay_map_flags_row_ptr = &overlay_map_flags[0][0];
-    uint8_t const* overlay_map_row_nchars_ptr = &overlay_map_row_nchars[0];
-    // note: keeps track of number of printable characters on line, if none skip
-    //       scanline
-    int32_t overlay_line = 0;
-    int32_t overlay_line_times_tile_width = 0;
-    int32_t overlay_line_times_tile_width_flipped =
-        (tile_height - 1) * tile_width;
-    // note: -1 to place at start of last row in overlay image
-
-    // pointer to collision map starting at top left of screen
-    sprite_ix* collision_map_row_ptr = collision_map;
-    // keeps track of how many scanlines have been rendered since last DMA
-    // transfer
-    int32_t dma_scanline_count = 0;
-    // buffer to render
-    uint16_t* render_buf_ptr = dma_buffers.current_buffer();
-    // prepare visible sprites lists based on layer index
-    update_render_sprite_lists();
-    // for all lines on display
-    int32_t remaining_y = display_height;
-    while (remaining_y) {
-        // render from tiles map, sprites and overlay to the 'render_buf_ptr'
-        int32_t const render_n_tile_lines =
-            remaining_y < tile_height ? remaining_y : tile_height;
-        // prepare loop variables
-        int32_t render_n_scanlines = 0;
-        int32_t tile_line = 0;
-        int32_t tile_line_times_tile_width = 0;
-        int32_t tile_line_times_tile_width_flipped = 0;
-        if (tile_y_fract) {
-            // note: assumes display height is at least a tile height -1
-            render_n_scanlines = tile_height - tile_y_fract;
-            tile_line = tile_y_fract;
-            tile_line_times_tile_width = tile_y_fract * tile_width;
-            tile_line_times_tile_width_flipped =
-                (tile_height - 1 - tile_y_fract) * tile_width;
-            // note: -1 to place at start of last row in tile image
-            tile_y_fract = 0;
+    int32_t const tile_x = render_x >> tile_width_shift;
+    int32_t const tile_x_fract = render_x & tile_width_and;
+
+    int32_t const y = band * dma_n_scanlines;
+    int32_t const y_end = y + dma_band_scanlines(band);
+    // note: zones are not recorded by the second core
+    bool const profile = !render_parallel || &ctx == &render_contexts[0];
+    trace_scope const band_trace{"band",
+                                 engine_pipelined || !profile
+                                     ? trace_track_worker
+                                     : trace_track_main,
+                                 band};
+    uint32_t const band_t0 = render_overdraw ? device_cycles() : 0;
+    render_pixel* render_buf_ptr = render_band_buffer(ctx, dma_buf);
+    for (int32_t scanline_y = y; scanline_y < y_end; ++scanline_y) {
+        // row and line in tile map
+        int32_t const map_y = render_y + scanline_y;
+        int32_t const tile_y = map_y >> tile_height_shift;
+        int32_t const tile_line = map_y & tile_height_and;
+        // row and line in overlay
+        int32_t const overlay_y = scanline_y >> tile_height_shift;
+        int32_t const overlay_line = scanline_y & tile_height_and;
+
+        if (render_front_to_back) {
+            memset(ctx.coverage, 0, size_t(display_width));
+            if (render_overdraw) {
+                memset(render_overdraw_map + scanline_y * display_width, 0,
+                       size_t(display_width));
+            }
+            if (overlay_map_row_nchars[overlay_y] != 0) {
+                profiler_scope const zone{profiler_zone_overlay, profile};
+                render_scanline_overlay(ctx, render_buf_ptr, scanline_y,
+                                        overlay_y, overlay_line);
+            }
         } else {
-            render_n_scanlines = render_n_tile_lines;
-            tile_line_times_tile_width = tile_line = 0;
-            tile_line_times_tile_width_flipped = (tile_height - 1) * tile_width;
-        }
-        // render a row from tile map
-        while (tile_line < render_n_tile_lines) {
-            render_scanline_tiles(render_buf_ptr, palette_tiles,
-                                  &tile_imgs[0][0], tile_x, tile_x_fract,
-                                  tile_map_row_ptr, tile_map_flags_row_ptr,
-                                  scanline_y, tile_line_times_tile_width,
-                                  tile_line_times_tile_width_flipped);
-
-            render_scanline_sprites(render_buf_ptr, palette_sprites,
-                                    collision_map_row_ptr, tile_x, tile_x_fract,
-                                    scanline_y);
-
-            if (*overlay_map_row_nchars_ptr != 0) {
-                // there are characters to render on this scan line
-                render_scanline_tiles<true>(
-                    render_buf_ptr, palette_overlay, &overlay_imgs[0][0], 0, 0,
-                    overlay_map_row_ptr, overlay_map_flags_row_ptr, scanline_y,
-                    overlay_line_times_tile_width,
-                    overlay_line_times_tile_width_flipped);
+            {
+                profiler_scope const zone{profiler_zone_tiles, profile};
+                if (render_tile_row_cache) {
+                    memcpy(render_buf_ptr,
+                           render_tile_cache_scanline(tile_y, tile_line) +
+                               render_x,
+                           sizeof(render_pixel) * size_t(display_width));
+                    ctx.ops.add(counter_tile_pixels, uint32_t(display_width));
+                } else {
+                    render_scanline_tiles(
+                        render_buf_ptr, palette_tiles, &tile_imgs[0][0], tile_x,
+                        tile_x_fract, &tile_map[tile_y][0],
+                        &tile_map_flags[tile_y][0], int16_t(scanline_y),
+                        tile_line * tile_width,
+                        (tile_height - 1 - tile_line) * tile_width, ctx.ops);
+                    // note: -1 to place at start of last row in tile image
+                }
             }
 
-            ++tile_line;
-            tile_line_times_tile_width += tile_width;
-            tile_line_times_tile_width_flipped -= tile_width;
-
-            ++overlay_line;
-            overlay_line_times_tile_width += tile_width;
-            overlay_line_times_tile_width_flipped -= tile_width;
-            if ((overlay_line & tile_height_and) == 0) {
-                // new row
-                overlay_map_row_ptr += overlay_map_width;
-                overlay_map_flags_row_ptr += overlay_map_width;
-                overlay_line_times_tile_width = 0;
-                overlay_line_times_tile_width_flipped =
-                    (tile_height - 1) * tile_width;
-                ++overlay_map_row_nchars_ptr;
+            if (render_overdraw) {
+                // tiles write every pixel once
+                memset(render_overdraw_map + scanline_y * display_width, 1,
+                       size_t(display_width));
             }
+        }
+
+        {
+            profiler_scope const zone{profiler_zone_sprites, profile};
+            render_scanline_sprites(render_buf_ptr, palette_sprites, ctx,
+                                    int16_t(band), int16_t(scanline_y));
+        }
+
+        if (render_front_to_back) {
+            profiler_scope const zone{profiler_zone_tiles, profile};
+            render_scanline_tile_gaps(ctx, render_buf_ptr, scanline_y, tile_y,
+                                      tile_line);
+        } else if (overlay_map_row_nchars[overlay_y] != 0) {
+            // there are characters to render on this scan line
+            profiler_scope const zone{profiler_zone_overlay, profile};
+            render_scanline_overlay(ctx, render_buf_ptr, scanline_y, overlay_y,
+                                    overlay_line);
+        }
+
+        render_buf_ptr += display_width;
+    }
 
-            render_buf_ptr += display_width;
-            collision_map_row_ptr += display_width;
-            ++scanline_y;
-            ++dma_scanline_count;
-            if (dma_scanline_count == dma_n_scanlines) {
-                ++dma_writes;
-                dma_busy += device_dma_is_busy() ? 1 : 0;
-                device_dma_write_bytes(
-                    reinterpret_cast<uint8_t*>(dma_buffers.current_buffer()),
-                    uint32_t(display_width * dma_n_scanlines *
-                             sizeof(uint16_t)));
-                // swap to the other render buffer
-                render_buf_ptr = dma_buffers.swap();
-                dma_scanline_count = 0;
+    if (render_indexed) {
+        int32_t const n_px = display_width * (y_end - y);
+        if (render_skip_unchanged_bands) {
+            dma_band_index_signatures[band] =
+                dma_band_signature(ctx.band,
+                                   n_px * int32_t(sizeof(render_pixel)));
+        }
+        render_convert_indexed(dma_buf, ctx.band, n_px);
+        ctx.ops.add(counter_palette_lookups, uint32_t(n_px));
+    }
+
+    if (render_overdraw) {
+        render_band_cycles[band] = device_cycles() - band_t0;
+    }
+}
+
+// applies the collisions detected by the workers to the objects
+static inline auto render_apply_collisions() -> void {
+    for (int32_t i = 0; i < object_count; ++i) {
+        render_context const* latest = nullptr;
+        int16_t latest_band = -1;
+        for (render_context const& ctx : render_contexts) {
+            if (ctx.col_band[i] > latest_band) {
+                latest_band = ctx.col_band[i];
+                latest = &ctx;
             }
         }
-        ++tile_y;
-        remaining_y -= render_n_scanlines;
-        tile_map_row_ptr += tile_map_width;
-        tile_map_flags_row_ptr += tile_map_width;
+        if (!latest) {
+            continue;
+        }
+        object* other_obj = latest->col_with[i];
+        if (render_snapshot &&
+            (render_objects[i].freed ||
+             render_objects[objects.instance_ix(other_obj)].freed)) {
+            // object died during the update while rendering
+            continue;
+        }
+        objects.instance(i)->col_with = other_obj;
     }
-    // if 'display_height' is not evenly divisible by 'n_scanlines' there
-    // will be remaining scanlines to write
-    int32_t const dma_n_scanlines_trailing = display_height % dma_n_scanlines;
-    if (dma_n_scanlines_trailing) {
-        ++dma_writes;
-        dma_busy += device_dma_is_busy() ? 1 : 0;
-        device_dma_write_bytes(
-            reinterpret_cast<uint8_t*>(dma_buffers.current_buffer()),
-            uint32_t(display_width * dma_n_scanlines_trailing *
-                     sizeof(uint16_t)));
-        // swap to the other render buffer
-        dma_buffers.swap();
+}
+
+// renders tile map, sprites and overlay at 'render_x' and 'render_y' and
+// detects collisions without applying them to the objects
+static inline auto render_frame() -> void {
+    // clear stats for this frame
+    dma_busy = dma_writes = dma_skips = 0;
+
+#ifdef BAM_VERIFY_COLLISION_MAP
+    memset(collision_map_verify, sprite_ix_reserved,
+           size_t(display_width * display_height) * sizeof(sprite_ix));
+#endif
+
+    // clear collisions detected in previous frame
+    for (render_context& ctx : render_contexts) {
+        memset(ctx.col_band, 0xff, sizeof(ctx.col_band));
+    }
+
+    // prepare visible sprites lists based on layer index
+    {
+        profiler_scope const zone{profiler_zone_sprite_lists};
+        update_render_sprite_lists();
+    }
+
+    if (render_tile_row_cache) {
+        // render tile map rows that are not cached
+        profiler_scope const zone{profiler_zone_tiles};
+        render_tile_cache_update();
+    }
+
+    if (render_parallel) {
+        // start rendering odd bands on the second core
+        device_render_worker_begin();
+    }
+
+    for (int32_t band = 0; band < dma_bands_count; ++band) {
+        int32_t buf_ix = 0;
+        if (render_parallel && (band & 1)) {
+            // wait for band rendered by the second core
+            profiler_scope const zone{profiler_zone_dma_wait};
+            while ((buf_ix = dma_buffers.rendered(1, band)) == -1) {
+                device_render_worker_spin();
+            }
+        } else {
+            {
+                // note: waits for a buffer that is not being transferred
+                profiler_scope const zone{profiler_zone_dma_wait};
+                buf_ix = dma_buffers.acquire(0);
+            }
+            render_band(render_contexts[0], dma_buffers.buffer(buf_ix), band);
+        }
+        dma_write_band(buf_ix, band);
+    }
+    dma_band_signatures_valid = true;
+
+    if (render_parallel) {
+        device_render_worker_end();
+    }
+
+    for (render_context& ctx : render_contexts) {
+        counters_render.add(ctx.ops);
+        ctx.ops = counter_set{};
+    }
+}
+
+// called by the device on the second core to render every other band while
+// 'render(...)' renders and transfers bands or the whole frame when
+// 'engine_pipelined'
+inline auto render_worker() -> void {
+    if (engine_pipelined) {
+        render_frame();
+        return;
+    }
+    for (int32_t band = 1; band < dma_bands_count; band += 2) {
+        int32_t const buf_ix = dma_buffers.acquire(1);
+        render_band(render_contexts[1], dma_buffers.buffer(buf_ix), band);
+        dma_buffers.set_rendered(buf_ix, band);
     }
 }
 
+// renders tile map, sprites and overlay
+// ESP32-2432S028R: ~29 fps  dma: ~97%
+//     JC4827W543C: ~43 fps  dma: ~98%
+//     JC4827W543R: ~44 fps  dma: ~95%
+inline auto render(int32_t const x, int32_t const y) -> void {
+    render_x = x;
+    render_y = y;
+    render_frame();
+    render_apply_collisions();
+}
+
+// takes a snapshot of the sprites and the collision bits of the objects to be
+// rendered at 'x' and 'y'
+static inline auto render_take_snapshot(int32_t const x, int32_t const y)
+    -> void {
+    memcpy(render_sprites, sprites.all_list(),
+           sizeof(sprite) * size_t(sprite_count));
+
+    object const* const* end = objects.allocated_list_end();
+    for (object** it = objects.allocated_list(); it < end; ++it) {
+        object const* obj = *it;
+        render_object& ro = render_objects[objects.instance_ix(obj)];
+        ro.col_bits = obj->col_bits;
+        ro.col_mask = obj->col_mask;
+        ro.freed = false;
+    }
+
+    render_x = x;
+    render_y = y;
+}
+
+// takes a snapshot then starts rendering on the second core
+// note: the objects may be updated until 'render_wait()'
+inline auto render_async(int32_t const x, int32_t const y) -> void {
+    render_take_snapshot(x, y);
+    device_render_worker_begin();
+}
+
+// takes a snapshot then renders while calling 'engine_dma_busy_slice()' when
+// the DMA is busy
+inline auto render_cooperative(int32_t const x, int32_t const y) -> void {
+    render_take_snapshot(x, y);
+    render_frame();
+}
+
+// waits for 'render_async(...)' to complete then applies the collisions except
+// those involving objects freed during the update
+// note: called before 'objects.apply_free()'
+inline auto render_wait() -> void {
+    if (engine_pipelined) {
+        device_render_worker_end();
+    }
+
+    object const* const* end = objects.freed_list_end();
+    for (object** it = objects.freed_list(); it < end; ++it) {
+        render_objects[objects.instance_ix(*it)].freed = true;
+    }
+
+    render_apply_collisions();
+}
+
 // benchmarks full throughput
+
 // ESP32-2432S028R: ~31 fps  dma: ~100%
 //     JC4827W543C: ~44 fps  dma: ~98%
 //     JC4827W543R: ~46 fps  dma: ~100%
 inline auto render_bench(int32_t const x, int32_t const y) -> void {
     // current pixel value
-    static uint16_t px = 0;
     static uint16_t px0 = 0;
+    uint16_t px = px0;
 
     // clear stats for this frame
     dma_busy = dma_writes = 0;
 
-    // for all lines on display
-    int32_t remaining_y = display_height;
-    int32_t dma_scanline_count = 0;
-    uint16_t* render_buf_ptr = dma_buffers.current_buffer();
-    px = px0;
-    while (remaining_y) {
-        for (int32_t i = 0; i < display_width; ++i) {
-            *render_buf_ptr = px;
-            ++render_buf_ptr;
-        }
-        ++px;
-        --remaining_y;
-        ++dma_scanline_count;
-        if (dma_scanline_count == dma_n_scanlines) {
-            ++dma_writes;
-            dma_busy += device_dma_is_busy() ? 1 : 0;
-            device_dma_write_bytes(
-                reinterpret_cast<uint8_t*>(dma_buffers.current_buffer()),
-                uint32_t(display_width * dma_n_scanlines * sizeof(uint16_t)));
-            // swap to the other render buffer
-            render_buf_ptr = dma_buffers.swap();
-            dma_scanline_count = 0;
-        }
-    }
-    // if 'display_height' is not evenly divisible by 'n_scanlines' there
-    // will be remaining scanlines to write
-    int32_t const dma_n_scanlines_trailing = display_height % dma_n_scanlines;
-    if (dma_n_scanlines_trailing) {
+    // for all bands on display
+    for (int32_t band = 0; band < dma_bands_count; ++band) {
+        int32_t const buf_ix = dma_buffers.acquire(0);
+        uint16_t* render_buf_ptr = dma_buffers.buffer(buf_ix);
+        int32_t const n_scanlines = dma_band_scanlines(band);
+        for (int32_t j = 0; j < n_scanlines; ++j) {
+            for (int32_t i = 0; i < display_width; ++i) {
+                *render_buf_ptr = px;
+                ++render_buf_ptr;
+            }
+            ++px;
+        }
         ++dma_writes;
         dma_busy += device_dma_is_busy() ? 1 : 0;
         device_dma_write_bytes(
-            reinterpret_cast<uint8_t*>(dma_buffers.current_buffer()),
-            uint32_t(display_width * dma_n_scanlines_trailing *
-                     sizeof(uint16_t)));
-        // swap to the other render buffer
-        dma_buffers.swap();
+            reinterpret_cast<uint8_t*>(dma_buffers.buffer(buf_ix)),
+            uint32_t(display_width * n_scanlines * int32_t(sizeof(uint16_t))));
+        dma_buffers.set_transferring(buf_ix);
     }
     ++px0;
 }
+
+// benchmarks span kernels specialized for flip and full width against the
+// generic kernels with count known only at runtime
+// note: prints microseconds for rendering 'n' spans of each kind
+inline auto render_bench_spans(int32_t const n = 100000) -> void {
+    render_context& ctx = render_contexts[0];
+    render_pixel* buf = render_band_buffer(ctx, dma_buffers.buffer(0));
+    render_sprite_entry rse;
+    rse.spr = &sprites.all_list()[0];
+    // note: 'volatile' keeps the compiler from specializing generic kernels
+    int32_t volatile const tiles_n = tile_width;
+    int32_t volatile const sprites_n = sprite_width;
+    // note: spans are rendered side by side along a scanline so that the
+    //       compiler cannot discard them as overwritten
+    int32_t const tile_spans = display_width / tile_width;
+    int32_t const sprite_spans = display_width / sprite_width;
+    // results: generic, unrolled, generic flipped, unrolled flipped
+    uint32_t tiles_us[4];
+    uint32_t sprites_us[4];
+
+    uint32_t t0 = device_micros();
+    for (int32_t i = 0; i < n; ++i) {
+        render_tile_span<1>(buf + i % tile_spans * tile_width,
+                            tile_imgs[i & 1], palette_tiles, tiles_n);
+    }
+    tiles_us[0] = device_micros() - t0;
+
+    t0 = device_micros();
+    for (int32_t i = 0; i < n; ++i) {
+        render_tile_span_full<1>(buf + i % tile_spans * tile_width,
+                                 tile_imgs[i & 1], palette_tiles);
+    }
+    tiles_us[1] = device_micros() - t0;
+
+    t0 = device_micros();
+    for (int32_t i = 0; i < n; ++i) {
+        render_tile_span<-1>(buf + i % tile_spans * tile_width,
+                             &tile_imgs[i & 1][tile_width - 1], palette_tiles,
+                             tiles_n);
+    }
+    tiles_us[2] = device_micros() - t0;
+
+    t0 = device_micros();
+    for (int32_t i = 0; i < n; ++i) {
+        render_tile_span_full<-1>(buf + i % tile_spans * tile_width,
+                                  &tile_imgs[i & 1][tile_width - 1],
+                                  palette_tiles);
+    }
+    tiles_us[3] = device_micros() - t0;
+
+    // note: collision map is cleared before every span so that no collisions
+    //       are detected, same as for the first sprite on a scanline
+    for (int32_t k = 0; k < 4; ++k) {
+        bool const flip = k & 2;
+        bool const unrolled = k & 1;
+        uint8_t const* src =
+            flip ? &sprite_imgs[0][sprite_width - 1] : &sprite_imgs[0][0];
+        t0 = device_micros();
+        for (int32_t i = 0; i < n; ++i) {
+            int32_t const x = i % sprite_spans * sprite_width;
+            render_pixel* dst = buf + x;
+            sprite_ix* col = ctx.collision_map + x;
+            memset(col, sprite_ix_reserved, sizeof(sprite_ix) * sprite_width);
+#ifdef BAM_VERIFY_COLLISION_MAP
+            memset(collision_map_verify + x, sprite_ix_reserved,
+                   sizeof(sprite_ix) * sprite_width);
+#endif
+            if (flip && unrolled) {
+                render_sprite_span<-1, sprite_width>(
+                    dst, src, col, palette_sprites, ctx, &rse, 0, 0);
+            } else if (flip) {
+                render_sprite_span<-1>(dst, src, col, palette_sprites, ctx,
+                                       &rse, 0, 0, sprites_n);
+            } else if (unrolled) {
+                render_sprite_span<1, sprite_width>(
+                    dst, src, col, palette_sprites, ctx, &rse, 0, 0);
+            } else {
+                render_sprite_span<1>(dst, src, col, palette_sprites, ctx,
+                                      &rse, 0, 0, sprites_n);
+            }
+        }
+        sprites_us[k] = device_micros() - t0;
+    }
+
+    printf("------------------- span kernels -------------------------\n");
+    printf("             spans: %d\n", n);
+    printf("     tiles generic: %u us  flipped: %u us\n", tiles_us[0],
+           tiles_us[2]);
+    printf("    tiles unrolled: %u us  flipped: %u us\n", tiles_us[1],
+           tiles_us[3]);
+    printf("   sprites generic: %u us  flipped: %u us\n", sprites_us[0],
+           sprites_us[2]);
+    printf("  sprites unrolled: %u us  flipped: %u us\n", sprites_us[1],
+           sprites_us[3]);
+}
@@ -0,0 +1,163 @@
+#pragma once
+//
+// recording of timestamped engine events to a ring buffer exported as
+// Chrome trace json viewable in 'chrome://tracing' or 'ui.perfetto.dev'
+//
+
+// note: enabled with build flag `-D BAM_TRACE`
+// note: when not enabled nothing is recorded and the ring buffer is 1 event
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+
+#ifdef BAM_TRACE
+static bool constexpr trace_enabled = true;
+#else
+static bool constexpr trace_enabled = false;
+#endif
+
+// forward declarations to used device functions
+// returns nanoseconds since an arbitrary point in time
+auto device_trace_ns() -> uint64_t;
+
+// tracks of events displayed as threads
+enum trace_track : uint8_t {
+    trace_track_main,
+    trace_track_worker,
+    trace_track_dma,
+    trace_track_count
+};
+
+static char const* const trace_track_names[trace_track_count]{
+    "main", "render worker", "dma"};
+
+// event with begin and end
+// note: 'arg' is event specific such as band or number of bytes
+struct trace_event {
+    char const* name;
+    uint64_t begin_ns;
+    uint64_t end_ns;
+    int32_t arg;
+    trace_track track;
+};
+
+// number of events in the ring buffer where the oldest are overwritten
+static uint32_t constexpr trace_capacity = trace_enabled ? 1u << 16 : 1u;
+
+static trace_event trace_events[trace_capacity];
+// total number of events recorded
+static std::atomic<uint32_t> trace_count{0};
+
+// end of previous 'trace_mark(...)' on main track
+static uint64_t trace_mark_ns;
+
+// records event 'name' from 'begin_ns' to 'end_ns' on 'track'
+// note: may be called concurrently from the cores
+static inline auto trace_record(char const* name, uint64_t const begin_ns,
+                                uint64_t const end_ns,
+                                trace_track const track, int32_t const arg = -1)
+    -> void {
+    if (!trace_enabled) {
+        return;
+    }
+    uint32_t const ix =
+        trace_count.fetch_add(1, std::memory_order_relaxed) % trace_capacity;
+    trace_events[ix] = trace_event{name, begin_ns, end_ns, arg, track};
+}
+
+// starts a sequence of consecutive events on the main track
+static inline auto trace_mark_begin() -> void {
+    if (trace_enabled) {
+        trace_mark_ns = device_trace_ns();
+    }
+}
+
+// records event 'name' from previous mark to now on the main track
+static inline auto trace_mark(char const* name) -> void {
+    if (!trace_enabled) {
+        return;
+    }
+    uint64_t const t = device_trace_ns();
+    trace_record(name, trace_mark_ns, t, trace_track_main);
+    trace_mark_ns = t;
+}
+
+// records event 'name' from construction to destruction on 'track'
+class trace_scope final {
+  public:
+    explicit trace_scope(char const* name,
+                         trace_track const track = trace_track_main,
+                         int32_t const arg = -1)
+        : name_{name}, arg_{arg}, track_{track} {
+        if (trace_enabled) {
+            begin_ns_ = device_trace_ns();
+        }
+    }
+
+    ~trace_scope() {
+        if (trace_enabled) {
+            trace_record(name_, begin_ns_, device_trace_ns(), track_, arg_);
+        }
+    }
+
+    trace_scope(trace_scope const&) = delete;
+    auto operator=(trace_scope const&) -> trace_scope& = delete;
+
+  private:
+    char const* name_;
+    uint64_t begin_ns_{};
+    int32_t arg_;
+    trace_track track_;
+};
+
+// writes the recorded events as Chrome trace json to 'f'
+// note: the cores should not be recording while writing
+static inline auto trace_write(FILE* f) -> void {
+    if (!trace_enabled) {
+        return;
+    }
+    uint32_t const count = trace_count.load(std::memory_order_acquire);
+    uint32_t const n = count < trace_capacity ? count : trace_capacity;
+    uint32_t const first = count - n;
+    // timestamps relative to the oldest event
+    uint64_t t0 = UINT64_MAX;
+    for (uint32_t i = 0; i < n; ++i) {
+        uint64_t const t = trace_events[(first + i) % trace_capacity].begin_ns;
+        if (t < t0) {
+            t0 = t;
+        }
+    }
+    fprintf(f, "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [\n");
+    for (int32_t i = 0; i < trace_track_count; ++i) {
+        fprintf(f,
+                "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 0, "
+                "\"tid\": %d, \"args\": {\"name\": \"%s\"}}%s\n",
+                i, trace_track_names[i],
+                i + 1 < trace_track_count || n ? "," : "");
+    }
+    for (uint32_t i = 0; i < n; ++i) {
+        trace_event const& e = trace_events[(first + i) % trace_capacity];
+        fprintf(f,
+                "{\"name\": \"%s\", \"ph\": \"X\", \"pid\": 0, \"tid\": %d, "
+                "\"ts\": %.3f, \"dur\": %.3f, \"args\": {\"arg\": %d}}%s\n",
+                e.name, e.track, double(e.begin_ns - t0) / 1000.0,
+                double(e.end_ns - e.begin_ns) / 1000.0, e.arg,
+                i + 1 < n ? "," : "");
+    }
+    fprintf(f, "]}\n");
+}
+
+// writes the recorded events as Chrome trace json to file 'path'
+// returns false if file could not be written
+static inline auto trace_export(char const* path) -> bool {
+    if (!trace_enabled) {
+        return false;
+    }
+    FILE* f = fopen(path, "w");
+    if (!f) {
+        return false;
+    }
+    trace_write(f);
+    return fclose(f) == 0;
+}